@@ -0,0 +1,231 @@
+#include "Benchmark.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+namespace {
+    const long long MAX_ITERATIONS = 1000000000;
+
+    struct Registration {
+        std::string name;
+        BenchFunction function;
+        std::vector<long long> arguments;
+    };
+
+    struct BenchResult {
+        std::string name;
+        long long iterations;
+        double realNs;      // Per iteration
+        double cpuNs;
+        double itemsPerSecond;  // 0 if the benchmark reports no items
+    };
+
+    std::vector<Registration>& registry() {
+        static std::vector<Registration> benchmarks;  // Filled during static initialization
+        return benchmarks;
+    }
+
+    // Grows the iteration count until a single run lasts minTime seconds
+    BenchResult runBenchmark(const std::string& name, BenchFunction function, long long argument, double minTime) {
+        long long iterations = 1;
+        while (true) {
+            BenchState state(iterations, argument);
+            function(state);
+
+            double wall = state.getWallSeconds();
+            if (wall >= minTime || iterations >= MAX_ITERATIONS) {
+                BenchResult result;
+                result.name = name;
+                result.iterations = iterations;
+                result.realNs = wall * 1e9 / iterations;
+                result.cpuNs = state.getCpuSeconds() * 1e9 / iterations;
+                result.itemsPerSecond = state.getItemsProcessed() > 0 && wall > 0.0
+                    ? state.getItemsProcessed() / wall : 0.0;
+                return result;
+            }
+
+            long long next = wall < minTime / 10.0
+                ? iterations * 10
+                : (long long)(iterations * minTime * 1.4 / wall);
+            iterations = std::min(MAX_ITERATIONS, std::max(next, iterations + 1));
+        }
+    }
+
+    std::string formatRate(double perSecond) {
+        const char* units[] = {"", "k", "M", "G"};
+        int unit = 0;
+        while (perSecond >= 1000.0 && unit < 3) {
+            perSecond /= 1000.0;
+            unit++;
+        }
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(2) << perSecond << units[unit] << "/s";
+        return out.str();
+    }
+
+    bool writeJson(const std::string& path, const std::vector<BenchResult>& results) {
+        std::ofstream file(path);
+        if (!file.is_open()) {
+            return false;
+        }
+
+        char date[32];
+        std::time_t now = std::time(nullptr);
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+        file << "{\n  \"context\": {\n"
+             << "    \"date\": \"" << date << "\",\n"
+             << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n"
+#ifdef NDEBUG
+             << "    \"library_build_type\": \"release\"\n"
+#else
+             << "    \"library_build_type\": \"debug\"\n"
+#endif
+             << "  },\n  \"benchmarks\": [\n";
+
+        for (size_t i = 0; i < results.size(); i++) {
+            const BenchResult& result = results[i];
+            file << "    {\n"
+                 << "      \"name\": \"" << result.name << "\",\n"
+                 << "      \"run_type\": \"iteration\",\n"
+                 << "      \"iterations\": " << result.iterations << ",\n"
+                 << std::setprecision(6) << std::fixed
+                 << "      \"real_time\": " << result.realNs << ",\n"
+                 << "      \"cpu_time\": " << result.cpuNs << ",\n"
+                 << "      \"time_unit\": \"ns\"";
+            if (result.itemsPerSecond > 0.0) {
+                file << ",\n      \"items_per_second\": " << result.itemsPerSecond;
+            }
+            file << "\n    }" << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+
+        file << "  ]\n}\n";
+        return true;
+    }
+}
+
+BenchState::BenchState(long long iterations, long long argument)
+    : maxIterations(iterations), remaining(iterations), argument(argument), itemsProcessed(0),
+      running(false), paused(false), cpuStart(0), wallSeconds(0.0), cpuSeconds(0.0) {}
+
+void BenchState::startTimer() {
+    wallStart = std::chrono::steady_clock::now();
+    cpuStart = std::clock();
+}
+
+void BenchState::stopTimer() {
+    wallSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    cpuSeconds += (double)(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+}
+
+bool BenchState::keepRunning() {
+    if (!running) {
+        running = true;
+        startTimer();
+    }
+    if (remaining > 0) {
+        remaining--;
+        return true;
+    }
+    if (!paused) {
+        stopTimer();
+    }
+    return false;
+}
+
+void BenchState::pauseTiming() {
+    if (!paused) {
+        stopTimer();
+        paused = true;
+    }
+}
+
+void BenchState::resumeTiming() {
+    if (paused) {
+        paused = false;
+        startTimer();
+    }
+}
+
+int registerBenchmark(const char* name, BenchFunction fn, std::vector<long long> arguments) {
+    registry().push_back({name, fn, arguments});
+    return (int)registry().size();
+}
+
+// Usage: bench [--filter=SUBSTRING] [--min-time=SECONDS] [--json=FILE]
+int main(int argc, char** argv) {
+    std::string filter;
+    std::string jsonPath;
+    double minTime = 0.5;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg.rfind("--filter=", 0) == 0) {
+            filter = arg.substr(9);
+        } else if (arg.rfind("--min-time=", 0) == 0) {
+            minTime = std::stod(arg.substr(11));
+        } else if (arg.rfind("--json=", 0) == 0) {
+            jsonPath = std::filesystem::absolute(arg.substr(7)).string();
+        } else {
+            std::cout << "Usage: " << argv[0] << " [--filter=SUBSTRING] [--min-time=SECONDS] [--json=FILE]\n";
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+    // Benchmarks write their files (networks, movement log) under a scratch data/ folder
+    std::filesystem::path originalDir = std::filesystem::current_path();
+    std::filesystem::path workDir = std::filesystem::temp_directory_path() / "menu_app_bench";
+    std::filesystem::create_directories(workDir / "data");
+    std::filesystem::current_path(workDir);
+
+    // The models report every operation on std::cout; keep that out of the timings
+    std::ostream report(std::cout.rdbuf());
+    std::cout.setstate(std::ios::failbit);
+
+    report << std::left << std::setw(36) << "Benchmark" << std::right << std::setw(16) << "Time"
+           << std::setw(16) << "CPU" << std::setw(14) << "Iterations" << "  Items\n"
+           << std::string(96, '-') << "\n";
+
+    std::vector<BenchResult> results;
+    for (const Registration& benchmark : registry()) {
+        std::vector<long long> arguments = benchmark.arguments;
+        bool hasArgument = !arguments.empty();
+        if (!hasArgument) arguments.push_back(0);
+
+        for (long long argument : arguments) {
+            std::string name = benchmark.name;
+            if (hasArgument) {
+                name += '/';
+                name += std::to_string(argument);
+            }
+            if (!filter.empty() && name.find(filter) == std::string::npos) continue;
+
+            BenchResult result = runBenchmark(name, benchmark.function, argument, minTime);
+            results.push_back(result);
+
+            report << std::left << std::setw(36) << name << std::right << std::fixed << std::setprecision(0)
+                   << std::setw(13) << result.realNs << " ns" << std::setw(13) << result.cpuNs << " ns"
+                   << std::setw(14) << result.iterations << "  "
+                   << (result.itemsPerSecond > 0.0 ? formatRate(result.itemsPerSecond) : "") << "\n";
+            report.flush();
+        }
+    }
+
+    std::cout.clear();
+    std::filesystem::current_path(originalDir);
+    std::error_code ignored;
+    std::filesystem::remove_all(workDir, ignored);
+
+    if (!jsonPath.empty()) {
+        if (!writeJson(jsonPath, results)) {
+            std::cout << "Error: Could not write '" << jsonPath << "'\n";
+            return 1;
+        }
+        std::cout << "\nResults written to " << jsonPath << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,77 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <chrono>
+#include <ctime>
+#include <string>
+#include <vector>
+
+// Minimal microbenchmark harness modelled on Google Benchmark, kept in-tree
+// so the bench target builds offline. A benchmark is a function that loops
+// on keepRunning(); the runner grows the iteration count until one run
+// lasts at least --min-time seconds and reports that run.
+//
+//     void BM_Example(BenchState& state) {
+//         Setup setup(state.range());        // Not timed
+//         while (state.keepRunning()) {
+//             doNotOptimize(work(setup));
+//         }
+//         state.setItemsProcessed(state.iterations());
+//     }
+//     BENCHMARK_ARGS(BM_Example, {100, 1000});
+class BenchState {
+private:
+    long long maxIterations;
+    long long remaining;
+    long long argument;
+    long long itemsProcessed;
+    bool running;
+    bool paused;
+    std::chrono::steady_clock::time_point wallStart;
+    std::clock_t cpuStart;
+    double wallSeconds;
+    double cpuSeconds;
+
+    void startTimer();
+    void stopTimer();
+
+public:
+    BenchState(long long iterations, long long argument);
+
+    bool keepRunning();    // True while iterations remain; the first call starts the clock
+    void pauseTiming();    // Exclude per-iteration setup from the measurement
+    void resumeTiming();
+
+    long long range() const { return argument; }
+    long long iterations() const { return maxIterations; }
+    void setItemsProcessed(long long items) { itemsProcessed = items; }
+
+    long long getItemsProcessed() const { return itemsProcessed; }
+    double getWallSeconds() const { return wallSeconds; }
+    double getCpuSeconds() const { return cpuSeconds; }
+};
+
+typedef void (*BenchFunction)(BenchState&);
+
+// Runs fn once per argument ({} = once without one); used through the macros below
+int registerBenchmark(const char* name, BenchFunction fn, std::vector<long long> arguments = {});
+
+#define BENCH_CONCAT_INNER(a, b) a##b
+#define BENCH_CONCAT(a, b) BENCH_CONCAT_INNER(a, b)
+#define BENCHMARK(fn) \
+    static int BENCH_CONCAT(benchRegistration, __LINE__) = registerBenchmark(#fn, fn)
+#define BENCHMARK_ARGS(fn, ...) \
+    static int BENCH_CONCAT(benchRegistration, __LINE__) = registerBenchmark(#fn, fn, __VA_ARGS__)
+
+// Keeps the compiler from discarding a computed value
+template <typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    const volatile char* sink = reinterpret_cast<const volatile char*>(&value);
+    (void)*sink;
+#endif
+}
+
+#endif
@@ -0,0 +1,246 @@
+#include "Benchmark.h"
+#include "Algorithms.h"
+#include "RouteCache.h"
+#include "SearchScratch.h"
+#include "SnapshotPublisher.h"
+#include "models/Graph.h"
+#include <atomic>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    // Grid-like road network with node IDs 0..nodeCount-1: every node links
+    // to its right and lower neighbour (both directions) plus one random
+    // one-way shortcut, so the edge count is about 5 x nodeCount.
+    void addNodes(Graph& graph, int nodeCount) {
+        for (int id = 0; id < nodeCount; id++) {
+            graph.addNode(id, std::to_string(id));
+        }
+    }
+
+    void addRoads(Graph& graph, int nodeCount, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> anyNode(0, nodeCount - 1);
+        std::uniform_real_distribution<double> length(0.5, 5.0);
+        int width = 1;
+        while (width * width < nodeCount) width++;
+
+        for (int id = 0; id < nodeCount; id++) {
+            if ((id + 1) % width != 0 && id + 1 < nodeCount) {
+                graph.addEdge(id, id + 1, length(rng));
+                graph.addEdge(id + 1, id, length(rng));
+            }
+            if (id + width < nodeCount) {
+                graph.addEdge(id, id + width, length(rng));
+                graph.addEdge(id + width, id, length(rng));
+            }
+            int shortcut = anyNode(rng);
+            if (shortcut != id && !graph.hasEdge(id, shortcut)) {
+                graph.addEdge(id, shortcut, length(rng) * 4.0);
+            }
+        }
+    }
+
+    void buildNetwork(Graph& graph, int nodeCount) {
+        addNodes(graph, nodeCount);
+        addRoads(graph, nodeCount, 12345);
+    }
+}
+
+void BM_GraphAddEdge(BenchState& state) {
+    int nodeCount = (int)state.range();
+    long long edges = 0;
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        auto graph = std::make_unique<Graph>();
+        addNodes(*graph, nodeCount);
+        state.resumeTiming();
+
+        addRoads(*graph, nodeCount, 12345);
+
+        state.pauseTiming();
+        edges += graph->getEdgeCount();
+        graph.reset();
+        state.resumeTiming();
+    }
+    state.setItemsProcessed(edges);
+}
+BENCHMARK_ARGS(BM_GraphAddEdge, {1000, 10000, 100000});
+
+void BM_GraphFindNodeIndex(BenchState& state) {
+    int nodeCount = (int)state.range();
+    Graph graph;
+    addNodes(graph, nodeCount);
+
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> anyNode(0, nodeCount - 1);
+    std::vector<int> ids(4096);
+    for (int& id : ids) id = anyNode(rng);
+
+    size_t next = 0;
+    while (state.keepRunning()) {
+        doNotOptimize(graph.findNodeIndex(ids[next]));
+        next = (next + 1) & (ids.size() - 1);
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK_ARGS(BM_GraphFindNodeIndex, {1000, 100000});
+
+void BM_GraphLoadFromFile(BenchState& state) {
+    int nodeCount = (int)state.range();
+    std::string path = "data/bench_network_" + std::to_string(nodeCount) + ".csv";
+    {
+        Graph graph;
+        buildNetwork(graph, nodeCount);
+        graph.saveToFile(path);
+    }
+
+    long long items = 0;
+    while (state.keepRunning()) {
+        Graph graph;
+        graph.loadFromFile(path);
+        items += graph.getNodeCount() + graph.getEdgeCount();
+    }
+    state.setItemsProcessed(items);
+}
+BENCHMARK_ARGS(BM_GraphLoadFromFile, {1000, 10000, 100000});
+
+void BM_Dijkstra(BenchState& state) {
+    int nodeCount = (int)state.range();
+    Graph graph;
+    buildNetwork(graph, nodeCount);
+
+    while (state.keepRunning()) {
+        PathResult result = dijkstra(graph, 0, nodeCount - 1, false);
+        doNotOptimize(result.totalDistance);
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK_ARGS(BM_Dijkstra, {100, 1000, 4000});
+
+void BM_Bfs(BenchState& state) {
+    int nodeCount = (int)state.range();
+    Graph graph;
+    buildNetwork(graph, nodeCount);
+
+    long long visited = 0;
+    while (state.keepRunning()) {
+        TraversalResult result = bfs(graph, 0, false);
+        visited += (long long)result.visitedNodes.size();
+    }
+    state.setItemsProcessed(visited);
+}
+BENCHMARK_ARGS(BM_Bfs, {1000, 10000, 100000});
+
+void BM_Dfs(BenchState& state) {
+    int nodeCount = (int)state.range();
+    Graph graph;
+    buildNetwork(graph, nodeCount);
+
+    long long visited = 0;
+    while (state.keepRunning()) {
+        TraversalResult result = dfs(graph, 0, false);
+        visited += (long long)result.visitedNodes.size();
+    }
+    state.setItemsProcessed(visited);
+}
+BENCHMARK_ARGS(BM_Dfs, {1000, 10000, 100000});
+
+// Dispatch-style workload: a few popular origin/destination pairs asked over and over
+void BM_FindRouteHotPairs(BenchState& state) {
+    int nodeCount = (int)state.range();
+    Graph graph;
+    buildNetwork(graph, nodeCount);
+
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<int> pick(0, nodeCount - 1);
+    std::vector<std::pair<int, int>> pairs(64);
+    for (auto& pair : pairs) pair = {pick(rng), pick(rng)};
+
+    size_t next = 0;
+    while (state.keepRunning()) {
+        PathResult result = findRoute(graph, pairs[next].first, pairs[next].second, CostMetric::DISTANCE);
+        doNotOptimize(result.totalDistance);
+        if (++next == pairs.size()) next = 0;
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK_ARGS(BM_FindRouteHotPairs, {1000, 10000});
+
+void BM_RouteCacheHotPairs(BenchState& state) {
+    int nodeCount = (int)state.range();
+    Graph graph;
+    buildNetwork(graph, nodeCount);
+    RouteCache cache;
+
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<int> pick(0, nodeCount - 1);
+    std::vector<std::pair<int, int>> pairs(64);
+    for (auto& pair : pairs) pair = {pick(rng), pick(rng)};
+    for (const auto& pair : pairs) cache.route(graph, pair.first, pair.second, CostMetric::DISTANCE);  // Warm
+
+    size_t next = 0;
+    while (state.keepRunning()) {
+        PathResult result = cache.route(graph, pairs[next].first, pairs[next].second, CostMetric::DISTANCE);
+        doNotOptimize(result.totalDistance);
+        if (++next == pairs.size()) next = 0;
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK_ARGS(BM_RouteCacheHotPairs, {1000, 10000});
+
+// Snapshot queries while a writer thread keeps editing weights and publishing
+// new versions; the argument is the number of query threads (including the
+// timed one), so items/s shows the per-reader rate under contention
+void BM_SnapshotReadersUnderEdits(BenchState& state) {
+    const int nodeCount = 2000;
+    Graph graph;
+    buildNetwork(graph, nodeCount);
+    SnapshotPublisher publisher;
+    publisher.publish(graph);
+
+    std::atomic<bool> stop(false);
+    std::thread writer([&]() {
+        std::mt19937 rng(3);
+        std::uniform_int_distribution<int> anyNode(0, nodeCount - 2);
+        std::uniform_real_distribution<double> length(0.5, 5.0);
+        while (!stop.load(std::memory_order_relaxed)) {
+            int id = anyNode(rng);
+            graph.updateEdgeWeights({{id, id + 1, length(rng)}});
+            publisher.publish(graph);
+        }
+    });
+
+    auto query = [&publisher, nodeCount](std::mt19937& rng, SearchScratch& scratch) {
+        std::uniform_int_distribution<int> anyNode(0, nodeCount - 1);
+        std::shared_ptr<const RoutingSnapshot> snapshot = publisher.acquire();
+        PathResult result = snapshotDijkstra(*snapshot, anyNode(rng), anyNode(rng), scratch);
+        doNotOptimize(result.totalDistance);
+    };
+
+    std::vector<std::thread> readers;
+    for (long long i = 1; i < state.range(); i++) {
+        readers.emplace_back([&, i]() {
+            std::mt19937 rng((unsigned)i);
+            SearchScratch scratch;
+            while (!stop.load(std::memory_order_relaxed)) query(rng, scratch);
+        });
+    }
+
+    std::mt19937 rng(0);
+    SearchScratch scratch;
+    while (state.keepRunning()) {
+        query(rng, scratch);
+    }
+    state.setItemsProcessed(state.iterations());
+
+    stop.store(true);
+    writer.join();
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+}
+BENCHMARK_ARGS(BM_SnapshotReadersUnderEdits, {1, 2, 4});
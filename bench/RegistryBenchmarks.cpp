@@ -0,0 +1,159 @@
+#include "Benchmark.h"
+#include "models/HashTable.h"
+#include "services/GeneratorService.h"
+#include "services/IngestService.h"
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+    // IDs spread over the table so probing sees realistic collisions
+    std::vector<int> vehicleIds(int count) {
+        std::vector<int> ids;
+        for (int i = 0; i < count; i++) ids.push_back(i * 37 + 5);
+        return ids;
+    }
+
+    void fillRegistry(HashTable& registry, const std::vector<int>& ids) {
+        for (int id : ids) {
+            registry.addVehicle(id, std::to_string(100000 + id), "Sedan", id % 50, (id + 7) % 50);
+        }
+    }
+}
+
+void BM_RegistryAddVehicle(BenchState& state) {
+    std::vector<int> ids = vehicleIds((int)state.range());
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        auto registry = std::make_unique<HashTable>();
+        state.resumeTiming();
+
+        fillRegistry(*registry, ids);
+
+        state.pauseTiming();
+        registry.reset();
+        state.resumeTiming();
+    }
+    state.setItemsProcessed(state.iterations() * (long long)ids.size());
+}
+BENCHMARK_ARGS(BM_RegistryAddVehicle, {100, 10000, 100000});
+
+void BM_RegistrySearchVehicle(BenchState& state) {
+    std::vector<int> ids = vehicleIds((int)state.range());
+    HashTable registry;
+    fillRegistry(registry, ids);
+
+    size_t next = 0;
+    while (state.keepRunning()) {
+        doNotOptimize(registry.searchVehicle(ids[next]));
+        if (++next == ids.size()) next = 0;
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK_ARGS(BM_RegistrySearchVehicle, {100, 10000, 100000});
+
+// Telemetry-style position writes through the ID path and through a held handle
+void BM_RegistryUpdatePosition(BenchState& state) {
+    std::vector<int> ids = vehicleIds((int)state.range());
+    HashTable registry;
+    fillRegistry(registry, ids);
+
+    size_t next = 0;
+    int node = 0;
+    while (state.keepRunning()) {
+        registry.updatePosition(ids[next], node, node + 1);
+        if (++next == ids.size()) next = 0;
+        node = (node + 1) & 1023;
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK_ARGS(BM_RegistryUpdatePosition, {10000, 100000});
+
+void BM_RegistryHandleMoveTo(BenchState& state) {
+    std::vector<int> ids = vehicleIds((int)state.range());
+    HashTable registry;
+    fillRegistry(registry, ids);
+    std::vector<VehicleHandle> handles;
+    for (int id : ids) handles.push_back(registry.searchVehicle(id));
+
+    size_t next = 0;
+    int node = 0;
+    while (state.keepRunning()) {
+        handles[next].moveTo(node, node + 1);
+        if (++next == handles.size()) next = 0;
+        node = (node + 1) & 1023;
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK_ARGS(BM_RegistryHandleMoveTo, {10000, 100000});
+
+void BM_RegistryRemoveVehicle(BenchState& state) {
+    std::vector<int> ids = vehicleIds((int)state.range());
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        auto registry = std::make_unique<HashTable>();
+        fillRegistry(*registry, ids);
+        state.resumeTiming();
+
+        for (int id : ids) {
+            registry->removeVehicle(id);
+        }
+
+        state.pauseTiming();
+        registry.reset();
+        state.resumeTiming();
+    }
+    state.setItemsProcessed(state.iterations() * (long long)ids.size());
+}
+BENCHMARK_ARGS(BM_RegistryRemoveVehicle, {100, 10000, 100000});
+
+void BM_LogMovement(BenchState& state) {
+    std::remove("data/.movements.csv");
+    HashTable registry;
+
+    int vehicle = 0;
+    while (state.keepRunning()) {
+        registry.logMovement(vehicle, vehicle % 50, "success", 12.5);
+        vehicle = (vehicle + 1) % 100;
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LogMovement);
+
+// Full telemetry replay (read, parse, apply, batched log) on a fresh
+// registry each time, so no fix is skipped as stale; argument = workers
+void BM_TelemetryIngest(BenchState& state) {
+    const int NODES = 10000;
+    const int VEHICLES = 5000;
+    const long long FIXES = 200000;
+
+    GeneratorService generator;
+    GeneratorStats generated;
+    NetworkSpec spec;
+    spec.nodeCount = NODES;
+    generator.generateNetwork("data/bench_ingest_network.csv", spec, generated);
+    generator.generateTelemetry("data/bench_ingest_telemetry.csv", FIXES, VEHICLES, NODES, 1, generated);
+    Graph network;
+    network.loadFromFile("data/bench_ingest_network.csv");
+
+    IngestService ingest;
+    IngestOptions options;
+    options.workerCount = (int)state.range();
+    IngestStats stats;
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        std::remove("data/.movements.csv");
+        auto registry = std::make_unique<HashTable>();
+        for (int id = 0; id < VEHICLES; id++) registry->addVehicle(id, std::to_string(100000 + id), "Sedan", 0, 0);
+        state.resumeTiming();
+
+        ingest.ingestFile("data/bench_ingest_telemetry.csv", *registry, network, options, stats);
+
+        state.pauseTiming();
+        registry.reset();
+        state.resumeTiming();
+    }
+    state.setItemsProcessed(state.iterations() * FIXES);
+}
+BENCHMARK_ARGS(BM_TelemetryIngest, {1, 2, 4});
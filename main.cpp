@@ -5,6 +5,11 @@
 #include <memory>
 #include <fstream>
 #include <iomanip>
+#include <sstream>
+#include <limits>
+#include <algorithm>
+#include <chrono>
+#include <random>
 #include <conio.h>
 #include "utils/colors.h"
 #include "utils/inputUtils.h"
@@ -12,8 +17,15 @@
 #include "models/Graph.h"
 #include "models/HashTable.h"
 #include "Algorithms.h"
+#include "DistrictMatrix.h"
+#include "DynamicShortestPathTree.h"
+#include "RoutingSnapshot.h"
+#include "SnapshotPublisher.h"
+#include "SearchScratch.h"
+#include "Metrics.h"
 #include "views/MenuView.h"
 #include "views/MenuItem.h"
+#include "views/NetworkView.h"
 #include "controllers/NetworkController.h"
 #include "controllers/VehicleController.h"
 #include "services/SelectionService.h"
@@ -24,6 +36,9 @@
 // Global instances
 Graph cityNetwork;
 HashTable vehicleRegistry;
+DistrictMatrix districtMatrix;  // Optional all-pairs table, answers shortest paths inside it
+DynamicShortestPathTree depotTree;  // Distances from the tracked depot, repaired after edits
+SnapshotPublisher routingSnapshots;  // Immutable CSR versions for multi-threaded queries
 
 // Controllers
 NetworkController* networkController = nullptr;
@@ -50,6 +65,59 @@ void showAdjacencyMatrix() {
     cityNetwork.showAdjacencyMatrix();
 }
 
+void showDegreeReport() {
+    NetworkView view;
+    view.showDegreeReport(cityNetwork);
+}
+
+void showStructureReport() {
+    NetworkView view;
+    view.showStructureReport(cityNetwork);
+}
+
+void showFilteredAdjacencyList() {
+    messageService.showTitle("Filtered adjacency list");
+
+    if (cityNetwork.getNodeCount() == 0) {
+        messageService.showError("Network is empty!");
+        return;
+    }
+
+    UIService uiService;
+    int mode = uiService.showSelector("Filter adjacency list",
+        {"By ID range", "By name prefix"});
+    if (mode == -1) {
+        messageService.showCancelled();
+        return;
+    }
+
+    AdjacencyFilter filter;
+    if (mode == 0) {
+        auto minId = getIntInput("Enter minimum node ID: ");
+        if (!minId.has_value()) {
+            messageService.showCancelled();
+            return;
+        }
+        auto maxId = getIntInput("Enter maximum node ID: ");
+        if (!maxId.has_value()) {
+            messageService.showCancelled();
+            return;
+        }
+        filter.minId = minId.value();
+        filter.maxId = maxId.value();
+    } else {
+        auto prefix = getStringInput("Enter name prefix: ");
+        if (!prefix.has_value()) {
+            messageService.showCancelled();
+            return;
+        }
+        filter.namePrefix = prefix.value();
+    }
+
+    NetworkView view;
+    view.showAdjacencyList(cityNetwork, filter);
+}
+
 // ===== QUERIES AND ALGORITHMS =====
 void findShortestPath() {
     messageService.showTitle("Find shortest path");
@@ -65,8 +133,384 @@ void findShortestPath() {
         return;
     }
 
-    PathResult result = dijkstra(cityNetwork, nodePair.sourceId, nodePair.destId, true);
+    // A matrix over the whole network answers with a table lookup. A smaller
+    // district misses paths through outside nodes, and "unreachable" only
+    // means unreachable inside it, so both go to Dijkstra.
+    PathResult result;
+    if (districtMatrix.coversGraph(cityNetwork) &&
+        districtMatrix.lookup(nodePair.sourceId, nodePair.destId, result) && result.found) {
+        displayPath(cityNetwork, result);
+        std::cout << GRAY << "(answered from the district matrix)" << RESET << "\n";
+        return;
+    }
+
+    result = dijkstra(cityNetwork, nodePair.sourceId, nodePair.destId, true);
+    displayPath(cityNetwork, result);
+}
+
+void findFastestRouteAtTime() {
+    messageService.showTitle("Find fastest route (departure time)");
+
+    if (cityNetwork.getNodeCount() < 2) {
+        messageService.showError("Need at least 2 nodes in the network!");
+        return;
+    }
+
+    auto nodePair = selectionService.selectNodePair(cityNetwork, "SELECT SOURCE NODE", "SELECT DESTINATION NODE", false);
+    if (nodePair.cancelled) {
+        messageService.showCancelled();
+        return;
+    }
+
+    system("cls");
+    messageService.showTitle("Find fastest route (departure time)");
+
+    auto departure = getStringInput("Enter departure time (HH:MM): ");
+    if (!departure.has_value()) {
+        messageService.showCancelled();
+        return;
+    }
+
+    int hours = 0, minutes = 0;
+    char separator = 0;
+    std::stringstream ss(departure.value());
+    if (!(ss >> hours >> separator >> minutes) || separator != ':' ||
+        hours < 0 || hours > 23 || minutes < 0 || minutes > 59) {
+        messageService.showError("Invalid time! Use HH:MM (24h).");
+        return;
+    }
+
+    PathResult result = timeDependentDijkstra(cityNetwork, nodePair.sourceId, nodePair.destId, hours * 60.0 + minutes);
+    displayPath(cityNetwork, result);
+}
+
+void findRouteByCost() {
+    messageService.showTitle("Find route (cost and vehicle class)");
+
+    if (cityNetwork.getNodeCount() < 2) {
+        messageService.showError("Need at least 2 nodes in the network!");
+        return;
+    }
+
+    auto nodePair = selectionService.selectNodePair(cityNetwork, "SELECT SOURCE NODE", "SELECT DESTINATION NODE", false);
+    if (nodePair.cancelled) {
+        messageService.showCancelled();
+        return;
+    }
+
+    UIService uiService;
+    int metric = uiService.showSelector("Select cost function", {"Distance", "Free-flow time", "Tolls"});
+    if (metric == -1) {
+        messageService.showCancelled();
+        return;
+    }
+
+    std::vector<std::string> classes = {"Any", "Sedan", "Compact", "Truck"};
+    int vehicleClass = uiService.showSelector("Select vehicle class", classes);
+    if (vehicleClass == -1) {
+        messageService.showCancelled();
+        return;
+    }
+
+    PathResult result = findRoute(cityNetwork, nodePair.sourceId, nodePair.destId,
+                                  static_cast<CostMetric>(metric),
+                                  vehicleClass == 0 ? "" : classes[vehicleClass]);
+    displayPath(cityNetwork, result);
+}
+
+void findAlternativeRoutes() {
+    messageService.showTitle("Find alternative routes");
+
+    if (cityNetwork.getNodeCount() < 2) {
+        messageService.showError("Need at least 2 nodes in the network!");
+        return;
+    }
+
+    auto nodePair = selectionService.selectNodePair(cityNetwork, "SELECT SOURCE NODE", "SELECT DESTINATION NODE", false);
+    if (nodePair.cancelled) {
+        messageService.showCancelled();
+        return;
+    }
+
+    system("cls");
+    messageService.showTitle("Find alternative routes");
+
+    auto count = getIntInput("How many routes (1-10): ");
+    if (!count.has_value()) {
+        messageService.showCancelled();
+        return;
+    }
+
+    if (count.value() < 1 || count.value() > 10) {
+        messageService.showError("Route count must be between 1 and 10!");
+        return;
+    }
+
+    std::vector<PathResult> routes = kShortestPaths(cityNetwork, nodePair.sourceId, nodePair.destId, count.value());
+    displayAlternatives(cityNetwork, routes);
+}
+
+void showReachableArea() {
+    messageService.showTitle("Reachable area (isochrone)");
+
+    if (cityNetwork.getNodeCount() == 0) {
+        messageService.showError("Network is empty!");
+        return;
+    }
+
+    int sourceId = selectionService.selectNode(cityNetwork, "SELECT SOURCE NODE");
+    if (sourceId == -1) {
+        messageService.showCancelled();
+        return;
+    }
+
+    UIService uiService;
+    int metric = uiService.showSelector("Measure radius by", {"Distance (km)", "Free-flow time (min)"});
+    if (metric == -1) {
+        messageService.showCancelled();
+        return;
+    }
+
+    system("cls");
+    messageService.showTitle("Reachable area (isochrone)");
+
+    auto radius = getDoubleInput("Radius (0 = whole network): ", false);
+    if (!radius.has_value()) {
+        messageService.showCancelled();
+        return;
+    }
+
+    double limit = radius.value() > 0 ? radius.value() : std::numeric_limits<double>::infinity();
+    ShortestPathTree tree = shortestPathTree(cityNetwork, sourceId, static_cast<CostMetric>(metric), limit);
+    displayShortestPathTree(cityNetwork, tree);
+}
+
+void trackDepot() {
+    messageService.showTitle("Track depot");
+
+    if (cityNetwork.getNodeCount() == 0) {
+        messageService.showError("Network is empty!");
+        return;
+    }
+
+    int depotId = selectionService.selectNode(cityNetwork, "SELECT DEPOT");
+    if (depotId == -1) {
+        messageService.showCancelled();
+        return;
+    }
+
+    UIService uiService;
+    int metric = uiService.showSelector("Measure distances by", {"Distance (km)", "Free-flow time (min)", "Toll"});
+    if (metric == -1) {
+        messageService.showCancelled();
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    depotTree.build(cityNetwork, depotId, static_cast<CostMetric>(metric));
+    double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    system("cls");
+    messageService.showSuccess("Depot tree built in " + std::to_string((int)elapsedMs) + " ms.");
+    std::cout << "Edge edits are now repaired incrementally when the depot distances are shown.\n";
+}
+
+void showDepotDistances() {
+    messageService.showTitle("Depot distances");
+
+    if (!depotTree.isBuilt()) {
+        messageService.showError("No depot tracked yet!");
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    TreeRepairStats stats = depotTree.refresh(cityNetwork);
+    double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    displayShortestPathTree(cityNetwork, depotTree.getTree());
+
+    std::cout << "\n" << GRAY;
+    if (stats.rebuilt) {
+        std::cout << "Tree rebuilt from scratch";
+    } else if (stats.edgesChanged == 0) {
+        std::cout << "Tree already up to date";
+    } else {
+        std::cout << stats.edgesChanged << " edge edit(s) repaired: " << stats.nodesInvalidated
+                  << " node(s) recomputed, " << stats.improvements << " improvement(s)";
+    }
+    std::cout << " (" << std::fixed << std::setprecision(2) << elapsedMs << " ms)" << RESET << "\n";
+}
+
+void computeAllServiceAreas() {
+    messageService.showTitle("Service areas (all nodes)");
+
+    if (cityNetwork.getNodeCount() == 0) {
+        messageService.showError("Network is empty!");
+        return;
+    }
+
+    auto budget = getDoubleInput("Travel time budget in minutes: ");
+    if (!budget.has_value()) {
+        messageService.showCancelled();
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<ServiceArea> areas = computeServiceAreas(cityNetwork, budget.value(), CostMetric::TIME);
+    double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::vector<ServiceArea> ranked = areas;
+    std::sort(ranked.begin(), ranked.end(), [](const ServiceArea& a, const ServiceArea& b) {
+        return a.reachableCount > b.reachableCount;
+    });
+
+    std::cout << "\n" << areas.size() << " origin(s) computed in " << std::fixed << std::setprecision(1)
+              << elapsedMs << " ms\n\n";
+    std::cout << BOLD << "Best-covered origins" << RESET << "\n";
+    std::cout << std::setw(6) << "ID" << " | " << std::setw(20) << "Name" << " | "
+              << std::setw(10) << "Reachable" << " | " << "Farthest (min)" << "\n";
+    std::cout << std::string(60, '-') << "\n";
+    for (size_t i = 0; i < ranked.size() && i < 10; i++) {
+        std::cout << std::setw(6) << ranked[i].nodeId << " | "
+                  << std::setw(20) << cityNetwork.getNodeName(ranked[i].nodeId) << " | "
+                  << std::setw(10) << ranked[i].reachableCount << " | "
+                  << std::setprecision(1) << ranked[i].farthestCost << "\n";
+    }
+
+    auto filename = getStringInput("\nExport to file (without extension, ESC to skip): ");
+    withInput(filename, [&](const std::string& name) {
+        fileService.exportServiceAreas(name, cityNetwork, areas, budget.value());
+    });
+}
+
+void buildDistrictMatrix() {
+    messageService.showTitle("Build district matrix");
+
+    if (cityNetwork.getNodeCount() == 0) {
+        messageService.showError("Network is empty!");
+        return;
+    }
+
+    UIService uiService;
+    int scope = uiService.showSelector("District nodes", {"Whole network", "Node ID range"});
+    if (scope == -1) {
+        messageService.showCancelled();
+        return;
+    }
+
+    system("cls");
+    messageService.showTitle("Build district matrix");
+
+    std::vector<int> ids;
+    if (scope == 1) {
+        auto minId = getIntInput("First node ID: ");
+        if (!minId.has_value()) {
+            messageService.showCancelled();
+            return;
+        }
+        auto maxId = getIntInput("Last node ID: ");
+        if (!maxId.has_value()) {
+            messageService.showCancelled();
+            return;
+        }
+
+        if (minId.value() > maxId.value()) {
+            messageService.showError("First node ID must not be greater than the last!");
+            return;
+        }
+
+        // Walks the nodes rather than the ID range, which may be far wider than the network
+        const Node* nodes = cityNetwork.getNodes();
+        for (int i = 0; i < cityNetwork.getMaxNodes(); i++) {
+            if (!nodes[i].active || nodes[i].id < minId.value() || nodes[i].id > maxId.value()) continue;
+            if ((int)ids.size() == MAX_DISTRICT_NODES) {
+                messageService.showError("More than " + std::to_string(MAX_DISTRICT_NODES) +
+                                         " nodes in that ID range!");
+                return;
+            }
+            ids.push_back(nodes[i].id);
+        }
+        if (ids.empty()) {
+            messageService.showError("No nodes in that ID range!");
+            return;
+        }
+    } else if (cityNetwork.getNodeCount() > MAX_DISTRICT_NODES) {
+        messageService.showError("Network is too large for a single district!");
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    if (districtMatrix.build(cityNetwork, ids)) {
+        double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "District matrix built: " << districtMatrix.getSize() << " nodes in "
+                  << (long long)(elapsedMs + 0.5) << " ms\n";
+        if (districtMatrix.coversGraph(cityNetwork)) {
+            messageService.showSuccess("Shortest path queries on the whole network now use the matrix.");
+        } else {
+            messageService.showSuccess("Use 'Route Within District' for paths through district nodes only.");
+        }
+    }
+}
+
+// Answers from the matrix without leaving the district; unlike Find Shortest
+// Path this may return a longer route, or none, when a better one runs outside
+void routeWithinDistrict() {
+    messageService.showTitle("Route within district");
+
+    if (!districtMatrix.isCurrent(cityNetwork)) {
+        messageService.showError("No up-to-date district matrix! Build or load one first.");
+        return;
+    }
+
+    auto nodePair = selectionService.selectNodePair(cityNetwork, "SELECT SOURCE NODE", "SELECT DESTINATION NODE", false);
+    if (nodePair.cancelled) {
+        messageService.showCancelled();
+        return;
+    }
+    if (!districtMatrix.contains(nodePair.sourceId) || !districtMatrix.contains(nodePair.destId)) {
+        messageService.showError("Both nodes must be inside the district!");
+        return;
+    }
+
+    PathResult result;
+    districtMatrix.lookup(nodePair.sourceId, nodePair.destId, result);
+    if (!result.found) {
+        messageService.showError("No path using district nodes only.");
+        return;
+    }
+
     displayPath(cityNetwork, result);
+    if (!districtMatrix.coversGraph(cityNetwork)) {
+        std::cout << GRAY << "(restricted to the " << districtMatrix.getSize()
+                  << " district nodes; a route through other nodes may be shorter)" << RESET << "\n";
+    }
+}
+
+void saveDistrictMatrix() {
+    messageService.showTitle("Save district matrix");
+
+    if (!districtMatrix.isCurrent(cityNetwork)) {
+        messageService.showError("No up-to-date district matrix to save!");
+        return;
+    }
+
+    auto filename = getStringInput("Enter filename (without extension): ");
+    if (!withInput(filename, [](const std::string& name) {
+        fileService.saveDistrictMatrix(name, districtMatrix);
+    })) {
+        messageService.showCancelled();
+    }
+}
+
+void loadDistrictMatrix() {
+    messageService.showTitle("Load district matrix");
+
+    auto filename = getStringInput("Enter filename (without extension): ");
+    if (!withInput(filename, [](const std::string& name) {
+        fileService.loadDistrictMatrix(name, districtMatrix, cityNetwork);
+    })) {
+        messageService.showCancelled();
+    }
 }
 
 void breadthFirstSearch() {
@@ -87,6 +531,93 @@ void breadthFirstSearch() {
     displayTraversal(cityNetwork, result, "BREADTH-FIRST SEARCH");
 }
 
+void levelBreadthFirstSearch() {
+    messageService.showTitle("Parallel BFS (levels)");
+
+    if (cityNetwork.getNodeCount() == 0) {
+        messageService.showError("Network is empty!");
+        return;
+    }
+
+    int startId = selectionService.selectNode(cityNetwork, "SELECT START NODE");
+    if (startId == -1) {
+        messageService.showCancelled();
+        return;
+    }
+
+    // The BFS workers read a published snapshot, rebuilt only after edits
+    auto start = std::chrono::steady_clock::now();
+    TraversalResult result = parallelBfs(*routingSnapshots.publishIfChanged(cityNetwork), startId);
+    double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    displayTraversal(cityNetwork, result, "PARALLEL BFS");
+    int depth = result.levels.empty() ? 0 : result.levels.back();
+    std::cout << "Reached " << result.visitedNodes.size() << " of " << cityNetwork.getNodeCount()
+              << " node(s), " << depth << " level(s) deep, in " << std::fixed << std::setprecision(2)
+              << elapsedMs << " ms\n";
+}
+
+void benchmarkNodeOrderings() {
+    messageService.showTitle("Benchmark node orderings");
+
+    if (cityNetwork.getNodeCount() < 2) {
+        messageService.showError("Network needs at least two nodes!");
+        return;
+    }
+
+    auto queries = getIntInput("Random shortest path queries per order: ");
+    if (!queries.has_value() || queries.value() <= 0) {
+        messageService.showCancelled();
+        return;
+    }
+
+    // Same endpoints for every order, fixed seed so runs are comparable
+    RoutingSnapshot insertion(cityNetwork);
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> pick(0, insertion.nodeCount - 1);
+    std::vector<std::pair<int, int>> pairs;
+    for (int i = 0; i < queries.value(); i++) {
+        pairs.push_back({insertion.nodeIds[pick(rng)], insertion.nodeIds[pick(rng)]});
+    }
+
+    std::cout << "\n" << std::setw(10) << "Order" << " | " << std::setw(10) << "Build ms" << " | "
+              << std::setw(10) << "Bandwidth" << " | " << std::setw(10) << "Avg span" << " | "
+              << std::setw(12) << "Dijkstra ms" << " | " << std::setw(8) << "BFS ms" << "\n";
+    std::cout << std::string(76, '-') << "\n";
+
+    SearchScratch scratch;
+    bool fellBack = false;
+    for (NodeOrder order : {NodeOrder::INSERTION, NodeOrder::BFS, NodeOrder::RCM, NodeOrder::HILBERT}) {
+        auto start = std::chrono::steady_clock::now();
+        RoutingSnapshot snapshot(cityNetwork, order);
+        double buildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        start = std::chrono::steady_clock::now();
+        for (const auto& [sourceId, destId] : pairs) {
+            snapshotDijkstra(snapshot, sourceId, destId, scratch);
+        }
+        double dijkstraMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        start = std::chrono::steady_clock::now();
+        parallelBfs(snapshot, pairs.front().first, 1);
+        double bfsMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        std::string name = nodeOrderName(snapshot.order);
+        if (snapshot.order != order) {
+            name = std::string(nodeOrderName(order)) + "*";
+            fellBack = true;
+        }
+
+        std::cout << std::setw(10) << name << " | " << std::fixed << std::setprecision(1)
+                  << std::setw(10) << buildMs << " | " << std::setw(10) << snapshot.bandwidth() << " | "
+                  << std::setw(10) << snapshot.averageEdgeSpan() << " | " << std::setw(12) << dijkstraMs << " | "
+                  << std::setw(8) << bfsMs << "\n";
+    }
+    if (fellBack) {
+        std::cout << "\n* Some nodes have no position; BFS order was used instead.\n";
+    }
+}
+
 void depthFirstSearch() {
     messageService.showTitle("Depth-first search");
 
@@ -167,14 +698,14 @@ void searchVehicle() {
 
     auto id = getIntInput("Enter vehicle ID to search: ");
     if (!withInput(id, [](int vehicleId) {
-        Vehicle* vehicle = vehicleRegistry.searchVehicle(vehicleId);
-        if (vehicle != nullptr) {
+        Vehicle vehicle;
+        if (vehicleRegistry.getVehicle(vehicleId, vehicle)) {
             std::cout << "\nVehicle found!\n";
-            std::cout << "ID: " << vehicle->id << "\n";
-            std::cout << "Plate: " << vehicle->plate << "\n";
-            std::cout << "Type: " << vehicle->type << "\n";
-            std::cout << "Current Node: " << vehicle->currentNodeId << "\n";
-            std::cout << "Destination Node: " << vehicle->destinationNodeId << "\n";
+            std::cout << "ID: " << vehicle.id << "\n";
+            std::cout << "Plate: " << vehicle.plate << "\n";
+            std::cout << "Type: " << vehicle.type << "\n";
+            std::cout << "Current Node: " << vehicle.currentNodeId << "\n";
+            std::cout << "Destination Node: " << vehicle.destinationNodeId << "\n";
         } else {
             messageService.showError("Vehicle not found!");
         }
@@ -221,8 +752,9 @@ void moveVehicle() {
         return;
     }
 
-    Vehicle* vehicle = vehicleRegistry.searchVehicle(vehicleId);
-    if (vehicle == nullptr) {
+    VehicleHandle handle = vehicleRegistry.searchVehicle(vehicleId);
+    Vehicle vehicle;
+    if (!handle.read(vehicle)) {
         messageService.showError("Vehicle not found!");
         return;
     }
@@ -233,17 +765,16 @@ void moveVehicle() {
         return;
     }
 
-    if (vehicle->currentNodeId == destId) {
+    if (vehicle.currentNodeId == destId) {
         system("cls");
         messageService.showError("Vehicle is already at destination!");
         return;
     }
 
-    PathResult result = dijkstra(cityNetwork, vehicle->currentNodeId, destId, true);
+    PathResult result = dijkstra(cityNetwork, vehicle.currentNodeId, destId, true);
 
     if (result.found) {
-        vehicle->currentNodeId = destId;
-        vehicle->destinationNodeId = destId;
+        handle.moveTo(destId, destId);
         vehicleRegistry.logMovement(vehicleId, destId, "success", result.travelTimeMinutes, "");
 
         displayPath(cityNetwork, result);
@@ -260,6 +791,79 @@ void showMovementHistory() {
     vehicleRegistry.showMovementHistory();
 }
 
+// ===== PERFORMANCE STATS =====
+void showPerformanceStats() {
+    messageService.showTitle("Performance stats");
+
+    std::cout << "Latencies in microseconds; animated / verbose runs are not timed.\n\n";
+    std::cout << std::left << std::setw(16) << "Operation" << std::right
+              << std::setw(10) << "Count" << std::setw(11) << "Mean"
+              << std::setw(11) << "p50" << std::setw(11) << "p90"
+              << std::setw(11) << "p99" << std::setw(11) << "p99.9"
+              << std::setw(11) << "Max" << "\n";
+    std::cout << std::string(92, '-') << "\n";
+
+    // Formatted apart so std::cout keeps its default float format
+    std::ostringstream table;
+    table << std::fixed << std::setprecision(1);
+    bool any = false;
+    bool anySampled = false;
+    for (int i = 0; i < OPERATION_COUNT; i++) {
+        Operation operation = (Operation)i;
+        const LatencyHistogram& histogram = metrics().getLatency(operation);
+        if (histogram.getCount() == 0) continue;
+        any = true;
+
+        // Sampled operations are marked with '*': exact count, latencies from a sample
+        std::string name = operationName(operation);
+        if (sampleInterval(operation) > 1) {
+            name += "*";
+            anySampled = true;
+        }
+
+        table << std::left << std::setw(16) << name << std::right
+              << std::setw(10) << metrics().getCallCount(operation)
+              << std::setw(11) << histogram.getMean() / 1000.0
+              << std::setw(11) << histogram.percentile(50.0) / 1000.0
+              << std::setw(11) << histogram.percentile(90.0) / 1000.0
+              << std::setw(11) << histogram.percentile(99.0) / 1000.0
+              << std::setw(11) << histogram.percentile(99.9) / 1000.0
+              << std::setw(11) << histogram.getMax() / 1000.0 << "\n";
+
+        unsigned long long settled = metrics().getCounter(operation, Counter::NODES_SETTLED);
+        unsigned long long relaxed = metrics().getCounter(operation, Counter::EDGES_RELAXED);
+        unsigned long long pushes = metrics().getCounter(operation, Counter::QUEUE_PUSHES);
+        if (settled + relaxed + pushes > 0) {
+            table << "    per query: " << (double)settled / histogram.getCount() << " settled, "
+                  << (double)relaxed / histogram.getCount() << " edges, "
+                  << (double)pushes / histogram.getCount() << " pushes\n";
+        }
+    }
+    std::cout << table.str();
+
+    if (!any) {
+        std::cout << "No operations recorded yet.\n";
+    } else if (anySampled) {
+        std::cout << "\n* Latencies from 1 call in " << SAMPLE_INTERVAL << "; the count is exact.\n";
+    }
+}
+
+void exportPerformanceStats() {
+    messageService.showTitle("Export performance stats");
+
+    auto filename = getStringInput("Enter filename (without extension): ");
+    if (!withInput(filename, [](const std::string& name) {
+        fileService.exportPerformanceStats(name);
+    })) {
+        messageService.showCancelled();
+    }
+}
+
+void resetPerformanceStats() {
+    metrics().reset();
+    messageService.showSuccess("Performance stats cleared.");
+}
+
 // ===== EXIT =====
 void exitAction() {
     std::cout << "Exiting application...\n";
@@ -280,17 +884,39 @@ int main() {
     roadNetworkMenu->addItem(5, MenuItem("Remove Node", []() { networkController->handleRemoveNode(); }));
     roadNetworkMenu->addItem(6, MenuItem("Remove Edge", []() { networkController->handleRemoveEdge(); }));
     roadNetworkMenu->addItem(7, MenuItem("Generate Seed File", []() { networkController->handleGenerateSeed(); }));
+    roadNetworkMenu->addItem(8, MenuItem("Remove Multiple Nodes", []() { networkController->handleRemoveNodes(); }));
+    roadNetworkMenu->addItem(9, MenuItem("Update Edge Weight", []() { networkController->handleUpdateEdgeWeight(); }));
+    roadNetworkMenu->addItem(10, MenuItem("Apply Weight Updates File", []() { networkController->handleApplyWeightUpdates(); }));
+    roadNetworkMenu->addItem(11, MenuItem("Set Edge Attributes", []() { networkController->handleSetEdgeAttributes(); }));
+    roadNetworkMenu->addItem(12, MenuItem("Set Node Position", []() { networkController->handleSetNodePosition(); }));
+    roadNetworkMenu->addItem(13, MenuItem("Generate Synthetic Network", []() { networkController->handleGenerateSyntheticNetwork(); }));
 
     // 2. Queries and Algorithms submenu (kept for manual testing)
     auto algorithmsMenu = std::make_shared<MenuView>("Network Analysis (Manual)");
     algorithmsMenu->addItem(1, MenuItem("Find Shortest Path", findShortestPath));
     algorithmsMenu->addItem(2, MenuItem("Breadth-First Search", breadthFirstSearch));
     algorithmsMenu->addItem(3, MenuItem("Depth-First Search", depthFirstSearch));
+    algorithmsMenu->addItem(4, MenuItem("Find Fastest Route (Departure Time)", findFastestRouteAtTime));
+    algorithmsMenu->addItem(5, MenuItem("Find Route (Cost & Vehicle Class)", findRouteByCost));
+    algorithmsMenu->addItem(6, MenuItem("Find Alternative Routes", findAlternativeRoutes));
+    algorithmsMenu->addItem(7, MenuItem("Show Reachable Area (Isochrone)", showReachableArea));
+    algorithmsMenu->addItem(8, MenuItem("Compute Service Areas (All Nodes)", computeAllServiceAreas));
+    algorithmsMenu->addItem(9, MenuItem("Build District Matrix", buildDistrictMatrix));
+    algorithmsMenu->addItem(10, MenuItem("Save District Matrix", saveDistrictMatrix));
+    algorithmsMenu->addItem(11, MenuItem("Load District Matrix", loadDistrictMatrix));
+    algorithmsMenu->addItem(12, MenuItem("Parallel BFS (Levels)", levelBreadthFirstSearch));
+    algorithmsMenu->addItem(13, MenuItem("Benchmark Node Orderings", benchmarkNodeOrderings));
+    algorithmsMenu->addItem(14, MenuItem("Track Depot (Maintained Tree)", trackDepot));
+    algorithmsMenu->addItem(15, MenuItem("Show Depot Distances", showDepotDistances));
+    algorithmsMenu->addItem(16, MenuItem("Route Within District", routeWithinDistrict));
 
     // 3. Network Visualization submenu
     auto visualizationMenu = std::make_shared<MenuView>("Network Visualization");
     visualizationMenu->addItem(1, MenuItem("Show Adjacency List", showAdjacencyList));
     visualizationMenu->addItem(2, MenuItem("Show Adjacency Matrix", showAdjacencyMatrix));
+    visualizationMenu->addItem(3, MenuItem("Show Filtered Adjacency List", showFilteredAdjacencyList));
+    visualizationMenu->addItem(4, MenuItem("Show Degree Report", showDegreeReport));
+    visualizationMenu->addItem(5, MenuItem("Show Structure Report", showStructureReport));
 
     // 4. Vehicle Management submenu
     auto vehicleMenu = std::make_shared<MenuView>("Vehicle Management");
@@ -304,6 +930,16 @@ int main() {
     vehicleMenu->addItem(8, MenuItem("Show Movement History", []() { vehicleController->handleShowMovementHistory(); }));
     vehicleMenu->addItem(9, MenuItem("Show Hash Info", []() { vehicleController->handleShowHashInfo(); }));
     vehicleMenu->addItem(10, MenuItem("Generate Vehicle Seed File", generateVehicleSeedFile));
+    vehicleMenu->addItem(11, MenuItem("Generate Synthetic Fleet", []() { vehicleController->handleGenerateSyntheticFleet(); }));
+    vehicleMenu->addItem(12, MenuItem("Show Route Cache Stats", []() { vehicleController->handleShowRouteCacheStats(); }));
+    vehicleMenu->addItem(13, MenuItem("Ingest Telemetry File", []() { vehicleController->handleIngestTelemetry(); }));
+    vehicleMenu->addItem(14, MenuItem("Generate Telemetry Replay", []() { vehicleController->handleGenerateTelemetry(); }));
+
+    // 5. Performance Stats submenu
+    auto performanceMenu = std::make_shared<MenuView>("Performance Stats");
+    performanceMenu->addItem(1, MenuItem("Show Latency Summary", showPerformanceStats));
+    performanceMenu->addItem(2, MenuItem("Export Stats (CSV)", exportPerformanceStats));
+    performanceMenu->addItem(3, MenuItem("Reset Stats", resetPerformanceStats));
 
     // Main menu
     MenuView mainMenu("Main menu");
@@ -311,7 +947,8 @@ int main() {
     mainMenu.addItem(2, MenuItem("Vehicle Management", vehicleMenu));
     mainMenu.addItem(3, MenuItem("Network Visualization", visualizationMenu));
     mainMenu.addItem(4, MenuItem("Network Analysis (Manual)", algorithmsMenu));
-    mainMenu.addItem(5, MenuItem("Exit", exitAction));
+    mainMenu.addItem(5, MenuItem("Performance Stats", performanceMenu));
+    mainMenu.addItem(6, MenuItem("Exit", exitAction));
 
     mainMenu.run();
 
@@ -3,33 +3,101 @@
 
 #include <vector>
 #include <string>
+#include <limits>
 #include "models/Graph.h"
 
+struct RoutingSnapshot;
+struct SearchScratch;
+
+// Edge cost used by findRoute
+enum class CostMetric {
+    DISTANCE,   // Edge weight (km)
+    TIME,       // Free-flow minutes
+    TOLL        // Cheapest, ties broken by distance
+};
+
 // Result structures
 struct PathResult {
     bool found;
     double totalDistance;
     std::vector<int> path;
     double travelTimeMinutes;
+    bool timeDependent;       // Travel time follows edge speed profiles
+    double departureMinute;   // Minute of day (time-dependent results only)
+    double arrivalMinute;
+    double totalToll;
 
-    PathResult() : found(false), totalDistance(0.0), travelTimeMinutes(0.0) {}
+    PathResult() : found(false), totalDistance(0.0), travelTimeMinutes(0.0),
+                   timeDependent(false), departureMinute(0.0), arrivalMinute(0.0), totalToll(0.0) {}
 };
 
 struct TraversalResult {
     std::vector<int> visitedNodes;
+    std::vector<int> levels;      // Hop count of each visited node (parallel BFS only)
     std::vector<std::string> steps;
     bool completed;
 
     TraversalResult() : completed(false) {}
 };
 
+// One-to-all search result; arrays are indexed by node slot (see Graph::getNodes)
+struct ShortestPathTree {
+    int sourceId;
+    CostMetric metric;
+    double radius;               // Nodes beyond this cost are left unreached
+    std::vector<double> dist;    // Cost from the source, infinity if unreached
+    std::vector<int> prev;       // Predecessor node ID, -1 for the source and unreached nodes
+    std::vector<int> order;      // Reached node IDs in ascending cost order
+
+    ShortestPathTree() : sourceId(-1), metric(CostMetric::DISTANCE), radius(0.0) {}
+};
+
+// Nodes reachable from one origin within a cost budget
+struct ServiceArea {
+    int nodeId;
+    int reachableCount;      // Includes the origin itself
+    double farthestCost;     // Cost of the last node settled inside the budget
+
+    ServiceArea() : nodeId(-1), reachableCount(0), farthestCost(0.0) {}
+};
+
 // Algorithm implementations
 PathResult dijkstra(const Graph& graph, int sourceId, int destId, bool verbose = true);
 TraversalResult bfs(const Graph& graph, int startId, bool verbose = true);
 TraversalResult dfs(const Graph& graph, int startId, bool verbose = true);
 
+// Direction-optimizing, level-synchronous BFS over a CSR snapshot (threadCount 0 = by graph size).
+// Nodes come out level by level; order within a level is unspecified when multi-threaded.
+TraversalResult parallelBfs(const RoutingSnapshot& snapshot, int startId, int threadCount = 0);
+TraversalResult parallelBfs(const Graph& graph, int startId, int threadCount = 0);
+
+// Distance-only point-to-point search on a CSR snapshot, reusing the caller's scratch buffers
+PathResult snapshotDijkstra(const RoutingSnapshot& snapshot, int sourceId, int destId, SearchScratch& scratch);
+
+// Route under a cost metric, skipping edges restricted for the vehicle type ("" = no class)
+PathResult findRoute(const Graph& graph, int sourceId, int destId, CostMetric metric,
+                     const std::string& vehicleType = "");
+
+// Full distance/predecessor arrays from one source, optionally bounded by a cost radius (isochrone)
+ShortestPathTree shortestPathTree(const Graph& graph, int sourceId, CostMetric metric = CostMetric::DISTANCE,
+                                  double radius = std::numeric_limits<double>::infinity());
+std::vector<int> treePath(const Graph& graph, const ShortestPathTree& tree, int destId);  // Empty if unreached
+
+// Service area of every active node, in slot order, computed across threads (0 = one per core)
+std::vector<ServiceArea> computeServiceAreas(const Graph& graph, double budget,
+                                             CostMetric metric = CostMetric::TIME, int threadCount = 0);
+
+// Up to k loopless routes by distance, shortest first (Yen's algorithm)
+std::vector<PathResult> kShortestPaths(const Graph& graph, int sourceId, int destId, int k);
+
+// Earliest-arrival route for a departure time (minute of day), using edge speed profiles
+PathResult timeDependentDijkstra(const Graph& graph, int sourceId, int destId, double departureMinute);
+
 // Helper functions
 void displayPath(const Graph& graph, const PathResult& result);
+void displayShortestPathTree(const Graph& graph, const ShortestPathTree& tree);
+void displayAlternatives(const Graph& graph, const std::vector<PathResult>& routes);
+std::string formatClockTime(double minuteOfDay);  // "HH:MM", wraps past midnight
 void displayTraversal(const Graph& graph, const TraversalResult& result, const std::string& algorithmName);
 
 #endif
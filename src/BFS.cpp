@@ -1,26 +1,29 @@
 #include "Algorithms.h"
+#include "Metrics.h"
 #include "utils/colors.h"
 #include "utils/keyUtils.h"
 #include <iostream>
 #include <iomanip>
 #include <queue>
+#include <vector>
 #include <thread>
 #include <chrono>
 
 TraversalResult bfs(const Graph& graph, int startId, bool verbose) {
     TraversalResult result;
+    ScopedTimer timer(Operation::BFS, !verbose);
 
     if (!graph.nodeExists(startId)) {
         if (verbose) std::cout << "Error: Start node " << startId << " not found!\n";
         return result;
     }
 
-    bool visited[MAX_NODES] = {false};
+    std::vector<bool> visited(graph.getMaxNodes(), false);
     std::queue<int> queue;
     const Node* nodes = graph.getNodes();
 
     queue.push(startId);
-    visited[startId] = true;
+    visited[graph.findNodeIndex(startId)] = true;
 
     if (verbose) {
         system("cls");
@@ -34,6 +37,8 @@ TraversalResult bfs(const Graph& graph, int startId, bool verbose) {
     }
 
     int step = 0;
+    unsigned long long edgesRelaxed = 0;
+    unsigned long long pushes = 1;
 
     while (!queue.empty()) {
         int currentId = queue.front();
@@ -61,7 +66,7 @@ TraversalResult bfs(const Graph& graph, int startId, bool verbose) {
                       << std::setw(12) << "Status" << "\n";
             std::cout << std::string(45, '-') << "\n";
 
-            for (int i = 0; i < MAX_NODES; i++) {
+            for (int i = 0; i < graph.getMaxNodes(); i++) {
                 if (nodes[i].active) {
                     std::cout << std::setw(6) << nodes[i].id << " | "
                               << std::setw(20) << nodes[i].name << " | ";
@@ -97,15 +102,23 @@ TraversalResult bfs(const Graph& graph, int startId, bool verbose) {
             // Find neighbor index
             int neighborIndex = graph.findNodeIndex(neighborId);
 
+            edgesRelaxed++;
             if (neighborIndex != -1 && !visited[neighborIndex]) {
                 visited[neighborIndex] = true;
                 queue.push(neighborId);
+                pushes++;
             }
 
             edge = edge->next;
         }
     }
 
+    if (!verbose) {
+        metrics().add(Operation::BFS, Counter::NODES_SETTLED, result.visitedNodes.size());
+        metrics().add(Operation::BFS, Counter::EDGES_RELAXED, edgesRelaxed);
+        metrics().add(Operation::BFS, Counter::QUEUE_PUSHES, pushes);
+    }
+
     result.completed = true;
     return result;
 }
@@ -128,7 +141,11 @@ void displayTraversal(const Graph& graph, const TraversalResult& result, const s
     for (size_t i = 0; i < result.visitedNodes.size(); i++) {
         int nodeId = result.visitedNodes[i];
         std::cout << std::setw(3) << (i + 1) << ". [" << nodeId << "] "
-                  << graph.getNodeName(nodeId) << "\n";
+                  << graph.getNodeName(nodeId);
+        if (i < result.levels.size()) {
+            std::cout << GRAY << "  (level " << result.levels[i] << ")" << RESET;
+        }
+        std::cout << "\n";
     }
 
     std::cout << std::string(50, '-') << "\n";
@@ -0,0 +1,79 @@
+#ifndef BOUNDED_QUEUE_H
+#define BOUNDED_QUEUE_H
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+// Multi-producer / multi-consumer FIFO with a fixed capacity. push() blocks
+// while the queue is full, which is how a fast producer is held back to
+// the pace of its consumers (backpressure) instead of buffering without
+// limit. close() wakes everyone: pushes fail, pops drain what is left.
+template <typename T>
+class BoundedQueue {
+private:
+    std::mutex mutex;
+    std::condition_variable notFull;
+    std::condition_variable notEmpty;
+    std::deque<T> items;
+    size_t capacity;
+    bool closed;
+    size_t peakDepth;
+    unsigned long long fullWaits;  // Pushes that had to wait for room
+
+public:
+    explicit BoundedQueue(size_t capacity)
+        : capacity(capacity > 0 ? capacity : 1), closed(false), peakDepth(0), fullWaits(0) {}
+
+    bool push(T item) {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (items.size() >= capacity && !closed) {
+            fullWaits++;
+            notFull.wait(lock, [this] { return items.size() < capacity || closed; });
+        }
+        if (closed) {
+            return false;
+        }
+
+        items.push_back(std::move(item));
+        if (items.size() > peakDepth) peakDepth = items.size();
+        lock.unlock();
+        notEmpty.notify_one();
+        return true;
+    }
+
+    bool pop(T& item) {
+        std::unique_lock<std::mutex> lock(mutex);
+        notEmpty.wait(lock, [this] { return !items.empty() || closed; });
+        if (items.empty()) {
+            return false;  // Closed and drained
+        }
+
+        item = std::move(items.front());
+        items.pop_front();
+        lock.unlock();
+        notFull.notify_one();
+        return true;
+    }
+
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            closed = true;
+        }
+        notFull.notify_all();
+        notEmpty.notify_all();
+    }
+
+    size_t getPeakDepth() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return peakDepth;
+    }
+
+    unsigned long long getFullWaits() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return fullWaits;
+    }
+};
+
+#endif
@@ -0,0 +1,168 @@
+#include "ComponentIndex.h"
+#include "DfsEngine.h"
+#include <algorithm>
+#include <numeric>
+
+namespace {
+    // Tarjan's SCC algorithm expressed as DfsEngine hooks
+    struct TarjanVisitor : DfsVisitor {
+        std::vector<int> order;
+        std::vector<int> low;
+        std::vector<int> component;
+        std::vector<char> onStack;
+        std::vector<int> stack;
+        int counter;
+        int componentCount;
+
+        explicit TarjanVisitor(int nodeCount)
+            : order(nodeCount, -1), low(nodeCount, -1), component(nodeCount, -1),
+              onStack(nodeCount, 0), counter(0), componentCount(0) {
+            stack.reserve(nodeCount);
+        }
+
+        void onDiscover(int node) {
+            order[node] = low[node] = counter++;
+            stack.push_back(node);
+            onStack[node] = 1;
+        }
+
+        void onEdge(int from, int to, int /*edge*/, DfsEdgeKind kind) {
+            if (kind != DfsEdgeKind::TREE && onStack[to]) {
+                low[from] = std::min(low[from], order[to]);
+            }
+        }
+
+        void onFinish(int node, int parent) {
+            if (low[node] == order[node]) {
+                int member;
+                do {
+                    member = stack.back();
+                    stack.pop_back();
+                    onStack[member] = 0;
+                    component[member] = componentCount;
+                } while (member != node);
+                componentCount++;
+            }
+            if (parent != -1) {
+                low[parent] = std::min(low[parent], low[node]);
+            }
+        }
+    };
+
+    int findRoot(std::vector<int>& parent, int node) {
+        while (parent[node] != node) {
+            parent[node] = parent[parent[node]];
+            node = parent[node];
+        }
+        return node;
+    }
+}
+
+ComponentIndex::ComponentIndex() : built(false), topologyVersion(0), weakCount(0) {}
+
+void ComponentIndex::refresh(const Graph& graph) {
+    if (!built || topologyVersion != graph.getTopologyVersion()) {
+        rebuild(graph);
+    }
+}
+
+void ComponentIndex::rebuild(const Graph& graph) {
+    RoutingSnapshot snapshot(graph);
+    int nodeCount = snapshot.nodeCount;
+
+    TarjanVisitor tarjan(nodeCount);
+    DfsEngine engine(snapshot);
+    engine.runAll(tarjan);
+
+    int strongCount = tarjan.componentCount;
+    strongSizes.assign(strongCount, 0);
+    strongIsSink.assign(strongCount, 1);
+    strongIsSource.assign(strongCount, 1);
+
+    std::vector<int> weakParent(nodeCount);
+    std::iota(weakParent.begin(), weakParent.end(), 0);
+
+    for (int node = 0; node < nodeCount; node++) {
+        strongSizes[tarjan.component[node]]++;
+        for (int e = snapshot.outOffsets[node]; e < snapshot.outOffsets[node + 1]; e++) {
+            int target = snapshot.outTargets[e];
+            if (tarjan.component[node] != tarjan.component[target]) {
+                strongIsSink[tarjan.component[node]] = 0;
+                strongIsSource[tarjan.component[target]] = 0;
+            }
+            int a = findRoot(weakParent, node);
+            int b = findRoot(weakParent, target);
+            if (a != b) weakParent[a] = b;
+        }
+    }
+
+    strongById.clear();
+    weakById.clear();
+    std::unordered_map<int, int> weakNumber;
+    for (int node = 0; node < nodeCount; node++) {
+        int root = findRoot(weakParent, node);
+        auto inserted = weakNumber.insert({root, (int)weakNumber.size()});
+        strongById[snapshot.nodeIds[node]] = tarjan.component[node];
+        weakById[snapshot.nodeIds[node]] = inserted.first->second;
+    }
+    weakCount = (int)weakNumber.size();
+
+    topologyVersion = graph.getTopologyVersion();
+    built = true;
+}
+
+Reachability ComponentIndex::reachability(int sourceId, int destId) const {
+    auto source = strongById.find(sourceId);
+    auto dest = strongById.find(destId);
+    if (source == strongById.end() || dest == strongById.end()) {
+        return Reachability::UNREACHABLE;
+    }
+
+    if (source->second == dest->second) {
+        return Reachability::REACHABLE;
+    }
+    if (weakById.at(sourceId) != weakById.at(destId) || source->second < dest->second) {
+        return Reachability::UNREACHABLE;
+    }
+    if (strongIsSink[source->second] || strongIsSource[dest->second]) {
+        return Reachability::UNREACHABLE;
+    }
+    return Reachability::UNKNOWN;
+}
+
+int ComponentIndex::strongComponentOf(int nodeId) const {
+    auto it = strongById.find(nodeId);
+    return it != strongById.end() ? it->second : -1;
+}
+
+int ComponentIndex::getLargestStrong() const {
+    if (strongSizes.empty()) return -1;
+    return (int)(std::max_element(strongSizes.begin(), strongSizes.end()) - strongSizes.begin());
+}
+
+std::vector<int> ComponentIndex::trapComponents() const {
+    std::vector<int> traps;
+    int largest = getLargestStrong();
+    for (int c = 0; c < (int)strongSizes.size(); c++) {
+        if (c != largest && strongIsSink[c] && !strongIsSource[c]) traps.push_back(c);
+    }
+    return traps;
+}
+
+std::vector<int> ComponentIndex::unreachableComponents() const {
+    std::vector<int> sources;
+    int largest = getLargestStrong();
+    for (int c = 0; c < (int)strongSizes.size(); c++) {
+        if (c != largest && strongIsSource[c] && !strongIsSink[c]) sources.push_back(c);
+    }
+    return sources;
+}
+
+std::vector<int> ComponentIndex::nodesIn(int component) const {
+    std::vector<int> ids;
+    for (const auto& [id, strong] : strongById) {
+        if (strong == component) ids.push_back(id);
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
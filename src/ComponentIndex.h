@@ -0,0 +1,51 @@
+#ifndef COMPONENT_INDEX_H
+#define COMPONENT_INDEX_H
+
+#include <unordered_map>
+#include <vector>
+#include "models/Graph.h"
+
+enum class Reachability {
+    REACHABLE,     // Same strongly connected component
+    UNREACHABLE,   // Proven by component structure, no search needed
+    UNKNOWN        // Components allow a path; a search has to decide
+};
+
+// Strongly and weakly connected components of a Graph, rebuilt lazily when
+// its topology version changes (weight edits keep the cache valid).
+// Strong components are numbered in completion order of Tarjan's
+// algorithm, which is a reverse topological order of the condensation:
+// any path from a to b satisfies strongId(a) >= strongId(b).
+class ComponentIndex {
+private:
+    bool built;
+    unsigned long long topologyVersion;
+    std::unordered_map<int, int> strongById;   // Node ID -> strong component
+    std::unordered_map<int, int> weakById;     // Node ID -> weak component
+    std::vector<int> strongSizes;
+    std::vector<char> strongIsSink;            // No edge leaves the component
+    std::vector<char> strongIsSource;          // No edge enters the component
+    int weakCount;
+
+    void rebuild(const Graph& graph);
+
+public:
+    ComponentIndex();
+
+    void refresh(const Graph& graph);  // O(1) when the topology is unchanged
+
+    Reachability reachability(int sourceId, int destId) const;
+    int strongComponentOf(int nodeId) const;  // -1 if unknown
+    int getStrongCount() const { return (int)strongSizes.size(); }
+    int getWeakCount() const { return weakCount; }
+    int getStrongSize(int component) const { return strongSizes[component]; }
+    int getLargestStrong() const;
+
+    // Components a vehicle can enter but never leave (sinks other than the largest)
+    std::vector<int> trapComponents() const;
+    // Components a vehicle can leave but never reach again (sources other than the largest)
+    std::vector<int> unreachableComponents() const;
+    std::vector<int> nodesIn(int component) const;  // Node IDs, ascending
+};
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef COST_POLICIES_H
+#define COST_POLICIES_H
+
+#include "models/Edge.h"
+#include "models/SpeedProfile.h"
+
+// Edge cost policies for the templated search kernels; each instantiation
+// inlines exactly one of these.
+struct DistanceCost {
+    static double cost(const Edge& edge) { return edge.weight; }
+};
+
+struct TimeCost {
+    static double cost(const Edge& edge) {
+        return edge.freeFlowMinutes > 0 ? edge.freeFlowMinutes
+                                        : edge.weight / DEFAULT_SPEED_KMH * 60.0;
+    }
+};
+
+struct TollCost {
+    static double cost(const Edge& edge) { return edge.toll + edge.weight * 1e-6; }
+};
+
+#endif
@@ -1,21 +1,24 @@
 #include "Algorithms.h"
+#include "Metrics.h"
 #include "utils/colors.h"
 #include "utils/keyUtils.h"
 #include <iostream>
 #include <iomanip>
 #include <stack>
+#include <vector>
 #include <thread>
 #include <chrono>
 
 TraversalResult dfs(const Graph& graph, int startId, bool verbose) {
     TraversalResult result;
+    ScopedTimer timer(Operation::DFS, !verbose);
 
     if (!graph.nodeExists(startId)) {
         if (verbose) std::cout << "Error: Start node " << startId << " not found!\n";
         return result;
     }
 
-    bool visited[MAX_NODES] = {false};
+    std::vector<bool> visited(graph.getMaxNodes(), false);
     std::stack<int> stack;
     const Node* nodes = graph.getNodes();
 
@@ -33,6 +36,8 @@ TraversalResult dfs(const Graph& graph, int startId, bool verbose) {
     }
 
     int step = 0;
+    unsigned long long edgesRelaxed = 0;
+    unsigned long long pushes = 1;
 
     while (!stack.empty()) {
         int currentId = stack.top();
@@ -65,7 +70,7 @@ TraversalResult dfs(const Graph& graph, int startId, bool verbose) {
                       << std::setw(12) << "Status" << "\n";
             std::cout << std::string(45, '-') << "\n";
 
-            for (int i = 0; i < MAX_NODES; i++) {
+            for (int i = 0; i < graph.getMaxNodes(); i++) {
                 if (nodes[i].active) {
                     std::cout << std::setw(6) << nodes[i].id << " | "
                               << std::setw(20) << nodes[i].name << " | ";
@@ -105,12 +110,20 @@ TraversalResult dfs(const Graph& graph, int startId, bool verbose) {
             // Find neighbor index
             int neighborIndex = graph.findNodeIndex(neighborId);
 
+            edgesRelaxed++;
             if (neighborIndex != -1 && !visited[neighborIndex]) {
                 stack.push(neighborId);
+                pushes++;
             }
         }
     }
 
+    if (!verbose) {
+        metrics().add(Operation::DFS, Counter::NODES_SETTLED, result.visitedNodes.size());
+        metrics().add(Operation::DFS, Counter::EDGES_RELAXED, edgesRelaxed);
+        metrics().add(Operation::DFS, Counter::QUEUE_PUSHES, pushes);
+    }
+
     result.completed = true;
     return result;
 }
@@ -0,0 +1,32 @@
+#include "DfsEngine.h"
+#include <algorithm>
+
+DfsEngine::DfsEngine(const RoutingSnapshot& snapshot)
+    : snapshot(snapshot),
+      discoveryTime(snapshot.nodeCount, -1),
+      finishTime(snapshot.nodeCount, -1),
+      parentNode(snapshot.nodeCount, -1),
+      parentEdge(snapshot.nodeCount, -1),
+      clock(0), backEdges(0), treeCount(0) {
+    postorder.reserve(snapshot.nodeCount);
+    stack.reserve(snapshot.nodeCount);
+}
+
+void DfsEngine::reset() {
+    std::fill(discoveryTime.begin(), discoveryTime.end(), -1);
+    std::fill(finishTime.begin(), finishTime.end(), -1);
+    std::fill(parentNode.begin(), parentNode.end(), -1);
+    std::fill(parentEdge.begin(), parentEdge.end(), -1);
+    postorder.clear();
+    stack.clear();
+    clock = 0;
+    backEdges = 0;
+    treeCount = 0;
+}
+
+std::vector<int> DfsEngine::topologicalOrder() const {
+    if (hasCycle()) {
+        return {};
+    }
+    return std::vector<int>(postorder.rbegin(), postorder.rend());
+}
@@ -0,0 +1,116 @@
+#ifndef DFS_ENGINE_H
+#define DFS_ENGINE_H
+
+#include <utility>
+#include <vector>
+#include "RoutingSnapshot.h"
+
+enum class DfsEdgeKind {
+    TREE,      // Target discovered through this edge
+    BACK,      // Target is an ancestor still on the stack (closes a cycle)
+    FORWARD,   // Target is an already finished descendant
+    CROSS      // Target is finished and in another subtree or tree
+};
+
+// No-op hooks; analyses derive from this and override what they need
+struct DfsVisitor {
+    void onDiscover(int /*node*/) {}
+    void onEdge(int /*from*/, int /*to*/, int /*edge*/, DfsEdgeKind /*kind*/) {}
+    void onFinish(int /*node*/, int /*parent*/) {}
+};
+
+// Iterative DFS on the dense indices of a RoutingSnapshot. All buffers are
+// sized once by the constructor; reset() rewinds them without allocating,
+// so one engine can serve many traversals. Edge indices refer to the
+// snapshot's outTargets array.
+class DfsEngine {
+private:
+    const RoutingSnapshot& snapshot;
+    std::vector<int> discoveryTime;   // -1 = not discovered
+    std::vector<int> finishTime;      // -1 = not finished
+    std::vector<int> parentNode;      // -1 for roots
+    std::vector<int> parentEdge;      // Tree edge that discovered the node, -1 for roots
+    std::vector<int> postorder;       // Nodes in finish order
+    std::vector<std::pair<int, int>> stack;  // (node, next edge to examine)
+    int clock;
+    int backEdges;
+    int treeCount;
+
+public:
+    explicit DfsEngine(const RoutingSnapshot& snapshot);
+
+    void reset();
+
+    // Visits everything reachable from start that is not yet discovered
+    template <typename Visitor>
+    void run(int start, Visitor& visitor);
+    void run(int start) { DfsVisitor visitor; run(start, visitor); }
+
+    // Forest over every node, roots taken in index order
+    template <typename Visitor>
+    void runAll(Visitor& visitor) {
+        for (int node = 0; node < snapshot.nodeCount; node++) {
+            if (discoveryTime[node] == -1) run(node, visitor);
+        }
+    }
+    void runAll() { DfsVisitor visitor; runAll(visitor); }
+
+    int getDiscoveryTime(int node) const { return discoveryTime[node]; }
+    int getFinishTime(int node) const { return finishTime[node]; }
+    int getParent(int node) const { return parentNode[node]; }
+    int getParentEdge(int node) const { return parentEdge[node]; }
+    bool isDiscovered(int node) const { return discoveryTime[node] != -1; }
+    const std::vector<int>& getPostorder() const { return postorder; }
+    int getTreeCount() const { return treeCount; }
+    bool hasCycle() const { return backEdges > 0; }
+    int getBackEdgeCount() const { return backEdges; }
+
+    // Reverse postorder; empty if a cycle was found (no topological order exists)
+    std::vector<int> topologicalOrder() const;
+};
+
+template <typename Visitor>
+void DfsEngine::run(int start, Visitor& visitor) {
+    if (start < 0 || start >= snapshot.nodeCount || discoveryTime[start] != -1) {
+        return;
+    }
+
+    treeCount++;
+    discoveryTime[start] = clock++;
+    visitor.onDiscover(start);
+    stack.push_back({start, snapshot.outOffsets[start]});
+
+    while (!stack.empty()) {
+        int node = stack.back().first;
+        int& nextEdge = stack.back().second;
+
+        if (nextEdge == snapshot.outOffsets[node + 1]) {
+            finishTime[node] = clock++;
+            postorder.push_back(node);
+            stack.pop_back();
+            visitor.onFinish(node, parentNode[node]);
+            continue;
+        }
+
+        int edge = nextEdge++;
+        int target = snapshot.outTargets[edge];
+
+        if (discoveryTime[target] == -1) {
+            visitor.onEdge(node, target, edge, DfsEdgeKind::TREE);
+            parentNode[target] = node;
+            parentEdge[target] = edge;
+            discoveryTime[target] = clock++;
+            visitor.onDiscover(target);
+            stack.push_back({target, snapshot.outOffsets[target]});  // May invalidate nextEdge
+        } else if (finishTime[target] == -1) {
+            backEdges++;
+            visitor.onEdge(node, target, edge, DfsEdgeKind::BACK);
+        } else if (discoveryTime[node] < discoveryTime[target]) {
+            visitor.onEdge(node, target, edge, DfsEdgeKind::FORWARD);
+        } else {
+            visitor.onEdge(node, target, edge, DfsEdgeKind::CROSS);
+        }
+    }
+}
+
+#endif
@@ -1,9 +1,11 @@
 #include "Algorithms.h"
+#include "Metrics.h"
 #include "utils/colors.h"
 #include "utils/keyUtils.h"
 #include <iostream>
 #include <iomanip>
 #include <limits>
+#include <vector>
 #include <thread>
 #include <chrono>
 
@@ -11,6 +13,7 @@ const double INF = std::numeric_limits<double>::max();
 
 PathResult dijkstra(const Graph& graph, int sourceId, int destId, bool verbose) {
     PathResult result;
+    ScopedTimer timer(Operation::DIJKSTRA, !verbose);  // Animated runs would time the step delays
 
     if (!graph.nodeExists(sourceId)) {
         if (verbose) std::cout << "Error: Source node " << sourceId << " not found!\n";
@@ -22,18 +25,16 @@ PathResult dijkstra(const Graph& graph, int sourceId, int destId, bool verbose)
         return result;
     }
 
-    // Initialize
-    double dist[MAX_NODES];
-    int prev[MAX_NODES];
-    bool visited[MAX_NODES];
+    // Initialize (arrays are indexed by node slot, not by node ID)
+    int slotCount = graph.getMaxNodes();
+    int sourceIndex = graph.findNodeIndex(sourceId);
+    int destIndex = graph.findNodeIndex(destId);
 
-    for (int i = 0; i < MAX_NODES; i++) {
-        dist[i] = INF;
-        prev[i] = -1;
-        visited[i] = false;
-    }
+    std::vector<double> dist(slotCount, INF);
+    std::vector<int> prev(slotCount, -1);
+    std::vector<bool> visited(slotCount, false);
 
-    dist[sourceId] = 0;
+    dist[sourceIndex] = 0;
 
     if (verbose) {
         system("cls");
@@ -48,6 +49,8 @@ PathResult dijkstra(const Graph& graph, int sourceId, int destId, bool verbose)
     }
 
     int step = 0;
+    unsigned long long edgesRelaxed = 0;
+    unsigned long long improvements = 0;
     const Node* nodes = graph.getNodes();
 
     // Main algorithm
@@ -56,7 +59,7 @@ PathResult dijkstra(const Graph& graph, int sourceId, int destId, bool verbose)
         double minDist = INF;
         int u = -1;
 
-        for (int i = 0; i < MAX_NODES; i++) {
+        for (int i = 0; i < slotCount; i++) {
             if (nodes[i].active && !visited[i] && dist[i] < minDist) {
                 minDist = dist[i];
                 u = i;
@@ -81,7 +84,7 @@ PathResult dijkstra(const Graph& graph, int sourceId, int destId, bool verbose)
                       << std::setw(10) << "Status" << "\n";
             std::cout << std::string(55, '-') << "\n";
 
-            for (int i = 0; i < MAX_NODES; i++) {
+            for (int i = 0; i < slotCount; i++) {
                 if (nodes[i].active) {
                     std::cout << std::setw(6) << nodes[i].id << " | "
                               << std::setw(20) << nodes[i].name << " | ";
@@ -112,43 +115,45 @@ PathResult dijkstra(const Graph& graph, int sourceId, int destId, bool verbose)
         // Update distances
         Edge* edge = nodes[u].adjacencyList;
         while (edge != nullptr) {
-            int v = edge->destination;
+            int v = graph.findNodeIndex(edge->destination);
             double weight = edge->weight;
 
-            if (!visited[v] && dist[u] + weight < dist[v]) {
+            edgesRelaxed++;
+            if (v != -1 && !visited[v] && dist[u] + weight < dist[v]) {
                 dist[v] = dist[u] + weight;
                 prev[v] = nodes[u].id;
+                improvements++;
             }
 
             edge = edge->next;
         }
 
         // Check if we reached destination
-        if (u == destId) {
+        if (u == destIndex) {
             break;
         }
     }
 
+    if (!verbose) {
+        metrics().add(Operation::DIJKSTRA, Counter::NODES_SETTLED, step);
+        metrics().add(Operation::DIJKSTRA, Counter::EDGES_RELAXED, edgesRelaxed);
+        metrics().add(Operation::DIJKSTRA, Counter::QUEUE_PUSHES, improvements);  // Linear scan: no heap, count decreases
+    }
+
     // Build path
-    if (dist[destId] != INF) {
+    if (dist[destIndex] != INF) {
         result.found = true;
-        result.totalDistance = dist[destId];
-        result.travelTimeMinutes = (dist[destId] / 60.0) * 60.0; // km / (km/h) * 60
+        result.totalDistance = dist[destIndex];
+        result.travelTimeMinutes = (dist[destIndex] / 60.0) * 60.0; // km / (km/h) * 60
 
         // Reconstruct path
         std::vector<int> reversePath;
         int current = destId;
         while (current != -1) {
             reversePath.push_back(current);
-            bool found = false;
-            for (int i = 0; i < MAX_NODES; i++) {
-                if (nodes[i].active && nodes[i].id == current) {
-                    current = prev[i];
-                    found = true;
-                    break;
-                }
-            }
-            if (!found) break;
+            int index = graph.findNodeIndex(current);
+            if (index == -1) break;
+            current = prev[index];
         }
 
         // Reverse to get correct order
@@ -175,7 +180,16 @@ void displayPath(const Graph& graph, const PathResult& result) {
               << result.totalDistance << " km\n";
     std::cout << "Travel Time: " << std::fixed << std::setprecision(1)
               << result.travelTimeMinutes << " minutes\n";
-    std::cout << "(at constant velocity of 60 km/h)\n\n";
+    if (result.totalToll > 0) {
+        std::cout << "Tolls: " << std::fixed << std::setprecision(2) << result.totalToll << "\n";
+    }
+    if (result.timeDependent) {
+        std::cout << "Departure: " << formatClockTime(result.departureMinute)
+                  << " | Arrival: " << formatClockTime(result.arrivalMinute) << "\n";
+        std::cout << "(using time-of-day speed profiles)\n\n";
+    } else {
+        std::cout << "(at constant velocity of 60 km/h)\n\n";
+    }
 
     std::cout << "Route:\n";
     std::cout << std::string(50, '-') << "\n";
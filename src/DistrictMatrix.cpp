@@ -0,0 +1,333 @@
+#include "DistrictMatrix.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <thread>
+#include <unordered_set>
+
+namespace {
+    const float UNREACHABLE = std::numeric_limits<float>::infinity();
+    const char MATRIX_MAGIC[4] = {'D', 'M', 'X', '1'};
+
+    unsigned long long mix(unsigned long long value) {
+        value += 0x9e3779b97f4a7c15ULL;
+        value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+        return value ^ (value >> 31);
+    }
+
+    // Runs task(0..count-1) on up to threadCount threads
+    template <typename Task>
+    void parallelFor(int count, int threadCount, Task task) {
+        if (threadCount <= 1 || count <= 1) {
+            for (int i = 0; i < count; i++) task(i);
+            return;
+        }
+
+        std::atomic<int> nextItem(0);
+        auto worker = [&]() {
+            for (int i = nextItem.fetch_add(1); i < count; i = nextItem.fetch_add(1)) {
+                task(i);
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (int t = 1; t < std::min(threadCount, count); t++) {
+            threads.emplace_back(worker);
+        }
+        worker();
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+}
+
+DistrictMatrix::DistrictMatrix() : size(0), stride(0), graphVersion(0), fingerprint(0) {}
+
+void DistrictMatrix::clear() {
+    size = 0;
+    stride = 0;
+    nodeIds.clear();
+    indexById.clear();
+    dist.clear();
+    next.clear();
+    graphVersion = 0;
+    fingerprint = 0;
+}
+
+// Order-independent per node, so a save/reload that reverses adjacency
+// lists still matches
+unsigned long long DistrictMatrix::computeFingerprint(const Graph& graph, const std::vector<int>& ids) {
+    std::unordered_map<int, int> members;
+    for (int i = 0; i < (int)ids.size(); i++) {
+        members[ids[i]] = i;
+    }
+
+    const Node* nodes = graph.getNodes();
+    unsigned long long hash = mix(ids.size());
+    for (int id : ids) {
+        int slot = graph.findNodeIndex(id);
+        if (slot == -1) {
+            return 0;
+        }
+
+        unsigned long long edgeSum = 0;
+        for (const Edge* edge = nodes[slot].adjacencyList; edge != nullptr; edge = edge->next) {
+            if (members.count(edge->destination) == 0) continue;
+            unsigned long long weightBits;
+            std::memcpy(&weightBits, &edge->weight, sizeof(weightBits));
+            edgeSum += mix(((unsigned long long)(unsigned int)edge->destination << 32) ^ mix(weightBits));
+        }
+        hash = mix(hash ^ (unsigned int)id) ^ edgeSum;
+    }
+    return hash;
+}
+
+// Min-plus update of one tile through one pivot tile. The inner loop is a
+// branch-free select over a contiguous row so the compiler vectorizes it;
+// the next-hop update is a mask blend because a conditional store is not.
+void DistrictMatrix::relaxTile(int rowTile, int colTile, int pivotTile) {
+    int rowStart = rowTile * DISTRICT_TILE;
+    int colStart = colTile * DISTRICT_TILE;
+    int pivotStart = pivotTile * DISTRICT_TILE;
+
+    for (int k = pivotStart; k < pivotStart + DISTRICT_TILE; k++) {
+        const float* pivotRow = &dist[(size_t)k * stride + colStart];
+
+        for (int i = rowStart; i < rowStart + DISTRICT_TILE; i++) {
+            size_t rowOffset = (size_t)i * stride;
+            float viaPivot = dist[rowOffset + k];
+            if (viaPivot == UNREACHABLE) continue;
+            int firstHop = next[rowOffset + k];
+
+            float* distRow = &dist[rowOffset + colStart];
+            int* nextRow = &next[rowOffset + colStart];
+            for (int j = 0; j < DISTRICT_TILE; j++) {
+                float current = distRow[j];
+                float candidate = viaPivot + pivotRow[j];
+                int better = -(int)(candidate < current);  // All ones when improved
+                nextRow[j] = (firstHop & better) | (nextRow[j] & ~better);
+                distRow[j] = candidate < current ? candidate : current;
+            }
+        }
+    }
+}
+
+// Blocked Floyd-Warshall: for each pivot tile, update the pivot tile, then
+// its row and column, then every remaining tile. Tiles within a phase are
+// independent, so each phase is spread across threads.
+void DistrictMatrix::runFloydWarshall(int threadCount) {
+    int tiles = stride / DISTRICT_TILE;
+
+    for (int pivot = 0; pivot < tiles; pivot++) {
+        relaxTile(pivot, pivot, pivot);
+
+        parallelFor(2 * tiles, threadCount, [&](int item) {
+            int tile = item / 2;
+            if (tile == pivot) return;
+            if (item % 2 == 0) {
+                relaxTile(pivot, tile, pivot);
+            } else {
+                relaxTile(tile, pivot, pivot);
+            }
+        });
+
+        parallelFor(tiles, threadCount, [&](int rowTile) {
+            if (rowTile == pivot) return;
+            for (int colTile = 0; colTile < tiles; colTile++) {
+                if (colTile != pivot) {
+                    relaxTile(rowTile, colTile, pivot);
+                }
+            }
+        });
+    }
+}
+
+bool DistrictMatrix::build(const Graph& graph, const std::vector<int>& ids, int threadCount) {
+    std::vector<int> district;
+    if (ids.empty()) {
+        const Node* nodes = graph.getNodes();
+        for (int i = 0; i < graph.getMaxNodes(); i++) {
+            if (nodes[i].active) district.push_back(nodes[i].id);
+        }
+    } else {
+        // Stops one past the cap, so an oversized request fails without a full pass
+        std::unordered_set<int> seen;
+        for (int id : ids) {
+            if ((int)district.size() > MAX_DISTRICT_NODES) break;
+            if (graph.nodeExists(id) && seen.insert(id).second) {
+                district.push_back(id);
+            }
+        }
+    }
+
+    if (district.empty()) {
+        std::cout << "Error: District has no nodes!\n";
+        return false;
+    }
+
+    if ((int)district.size() > MAX_DISTRICT_NODES) {
+        std::cout << "Error: District has more than " << MAX_DISTRICT_NODES << " nodes!\n";
+        return false;
+    }
+
+    clear();
+    nodeIds = district;
+    size = (int)nodeIds.size();
+    stride = (size + DISTRICT_TILE - 1) / DISTRICT_TILE * DISTRICT_TILE;
+    for (int i = 0; i < size; i++) {
+        indexById[nodeIds[i]] = i;
+    }
+
+    // Padding rows/columns stay unreachable and never improve a path
+    dist.assign((size_t)stride * stride, UNREACHABLE);
+    next.assign((size_t)stride * stride, -1);
+
+    const Node* nodes = graph.getNodes();
+    for (int i = 0; i < size; i++) {
+        size_t rowOffset = (size_t)i * stride;
+        dist[rowOffset + i] = 0.0f;
+        next[rowOffset + i] = i;
+
+        int slot = graph.findNodeIndex(nodeIds[i]);
+        for (const Edge* edge = nodes[slot].adjacencyList; edge != nullptr; edge = edge->next) {
+            auto it = indexById.find(edge->destination);
+            if (it == indexById.end()) continue;
+            float weight = (float)edge->weight;
+            if (weight < dist[rowOffset + it->second]) {
+                dist[rowOffset + it->second] = weight;
+                next[rowOffset + it->second] = it->second;
+            }
+        }
+    }
+
+    if (threadCount <= 0) {
+        threadCount = (int)std::max(1u, std::thread::hardware_concurrency());
+    }
+    runFloydWarshall(threadCount);
+
+    graphVersion = graph.getVersion();
+    fingerprint = computeFingerprint(graph, nodeIds);
+    return true;
+}
+
+double DistrictMatrix::distance(int sourceId, int destId) const {
+    auto source = indexById.find(sourceId);
+    auto dest = indexById.find(destId);
+    if (source == indexById.end() || dest == indexById.end()) {
+        return -1.0;
+    }
+
+    float value = dist[(size_t)source->second * stride + dest->second];
+    return value == UNREACHABLE ? -1.0 : value;
+}
+
+bool DistrictMatrix::lookup(int sourceId, int destId, PathResult& result) const {
+    auto source = indexById.find(sourceId);
+    auto dest = indexById.find(destId);
+    if (source == indexById.end() || dest == indexById.end()) {
+        return false;
+    }
+
+    result = PathResult();
+    int target = dest->second;
+    float value = dist[(size_t)source->second * stride + target];
+    if (value == UNREACHABLE) {
+        return true;  // Answered: no path inside the district
+    }
+
+    result.found = true;
+    result.totalDistance = value;
+    result.travelTimeMinutes = value / DEFAULT_SPEED_KMH * 60.0;
+    for (int current = source->second; ; current = next[(size_t)current * stride + target]) {
+        result.path.push_back(nodeIds[current]);
+        if (current == target) break;
+    }
+    return true;
+}
+
+bool DistrictMatrix::saveToFile(const std::string& filename) const {
+    if (!isBuilt()) {
+        std::cout << "Error: No district matrix to save!\n";
+        return false;
+    }
+
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        std::cout << "Error: Could not open file " << filename << "\n";
+        return false;
+    }
+
+    // Native byte order; the file is a local cache, not an exchange format
+    file.write(MATRIX_MAGIC, sizeof(MATRIX_MAGIC));
+    file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    file.write(reinterpret_cast<const char*>(&stride), sizeof(stride));
+    file.write(reinterpret_cast<const char*>(&fingerprint), sizeof(fingerprint));
+    file.write(reinterpret_cast<const char*>(nodeIds.data()), (std::streamsize)(nodeIds.size() * sizeof(int)));
+    file.write(reinterpret_cast<const char*>(dist.data()), (std::streamsize)(dist.size() * sizeof(float)));
+    file.write(reinterpret_cast<const char*>(next.data()), (std::streamsize)(next.size() * sizeof(int)));
+
+    if (!file) {
+        std::cout << "Error: Could not write district matrix!\n";
+        return false;
+    }
+    std::cout << "District matrix saved to '" << filename << "'\n";
+    return true;
+}
+
+bool DistrictMatrix::loadFromFile(const std::string& filename, const Graph& graph) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        std::cout << "Error: Could not open file " << filename << "\n";
+        return false;
+    }
+
+    char magic[4];
+    int fileSize = 0, fileStride = 0;
+    unsigned long long fileFingerprint = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&fileSize), sizeof(fileSize));
+    file.read(reinterpret_cast<char*>(&fileStride), sizeof(fileStride));
+    file.read(reinterpret_cast<char*>(&fileFingerprint), sizeof(fileFingerprint));
+
+    if (!file || std::memcmp(magic, MATRIX_MAGIC, sizeof(magic)) != 0 ||
+        fileSize <= 0 || fileSize > MAX_DISTRICT_NODES ||
+        fileStride != (fileSize + DISTRICT_TILE - 1) / DISTRICT_TILE * DISTRICT_TILE) {
+        std::cout << "Error: Not a district matrix file!\n";
+        return false;
+    }
+
+    std::vector<int> fileIds(fileSize);
+    file.read(reinterpret_cast<char*>(fileIds.data()), (std::streamsize)(fileIds.size() * sizeof(int)));
+    if (!file || computeFingerprint(graph, fileIds) != fileFingerprint) {
+        std::cout << "Error: District matrix does not match the loaded network!\n";
+        return false;
+    }
+
+    std::vector<float> fileDist((size_t)fileStride * fileStride);
+    std::vector<int> fileNext((size_t)fileStride * fileStride);
+    file.read(reinterpret_cast<char*>(fileDist.data()), (std::streamsize)(fileDist.size() * sizeof(float)));
+    file.read(reinterpret_cast<char*>(fileNext.data()), (std::streamsize)(fileNext.size() * sizeof(int)));
+    if (!file) {
+        std::cout << "Error: District matrix file is truncated!\n";
+        return false;
+    }
+
+    clear();
+    size = fileSize;
+    stride = fileStride;
+    nodeIds = std::move(fileIds);
+    dist = std::move(fileDist);
+    next = std::move(fileNext);
+    for (int i = 0; i < size; i++) {
+        indexById[nodeIds[i]] = i;
+    }
+    fingerprint = fileFingerprint;
+    graphVersion = graph.getVersion();
+
+    std::cout << "District matrix loaded: " << size << " nodes\n";
+    return true;
+}
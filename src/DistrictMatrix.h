@@ -0,0 +1,53 @@
+#ifndef DISTRICT_MATRIX_H
+#define DISTRICT_MATRIX_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "models/Graph.h"
+#include "Algorithms.h"
+
+const int MAX_DISTRICT_NODES = 4096;  // 64 MB of distances at the cap
+const int DISTRICT_TILE = 64;         // Tile edge; one row of a tile is 256 bytes
+
+// All-pairs distances for a small district, computed once with a tiled
+// Floyd-Warshall and answered in O(1). Distances only use edges inside the
+// district and are stored as float.
+class DistrictMatrix {
+private:
+    int size;                          // District nodes
+    int stride;                        // size rounded up to a whole number of tiles
+    std::vector<int> nodeIds;          // Matrix index -> node ID
+    std::unordered_map<int, int> indexById;
+    std::vector<float> dist;           // stride x stride, row-major
+    std::vector<int> next;             // First hop (matrix index) on the shortest path
+    unsigned long long graphVersion;   // Graph::getVersion() the matrix was built against
+    unsigned long long fingerprint;    // Content hash, lets a loaded matrix be matched to a graph
+
+    static unsigned long long computeFingerprint(const Graph& graph, const std::vector<int>& ids);
+    void relaxTile(int rowTile, int colTile, int pivotTile);
+    void runFloydWarshall(int threadCount);
+
+public:
+    DistrictMatrix();
+
+    // Empty ids = every active node. Fails if the district exceeds MAX_DISTRICT_NODES.
+    bool build(const Graph& graph, const std::vector<int>& ids = {}, int threadCount = 0);
+    void clear();
+
+    bool isBuilt() const { return size > 0; }
+    bool isCurrent(const Graph& graph) const { return isBuilt() && graphVersion == graph.getVersion(); }
+    // Current and built over every active node, so no shorter path can leave the district
+    bool coversGraph(const Graph& graph) const { return isCurrent(graph) && size == graph.getNodeCount(); }
+    bool contains(int nodeId) const { return indexById.count(nodeId) > 0; }
+    int getSize() const { return size; }
+
+    double distance(int sourceId, int destId) const;  // -1 if outside the district or unreachable
+    bool lookup(int sourceId, int destId, PathResult& result) const;
+
+    // Binary snapshot; load only accepts a file built from the same network
+    bool saveToFile(const std::string& filename) const;
+    bool loadFromFile(const std::string& filename, const Graph& graph);
+};
+
+#endif
@@ -0,0 +1,271 @@
+#include "DynamicShortestPathTree.h"
+#include "CostPolicies.h"
+#include <algorithm>
+#include <limits>
+#include <queue>
+
+namespace {
+    const double UNREACHED = std::numeric_limits<double>::infinity();
+
+    typedef std::pair<double, int> QueueEntry;
+    typedef std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> MinQueue;
+
+    // Plain Dijkstra from whatever is queued; entries that were improved
+    // after being pushed are skipped. Returns the number of improvements.
+    template <typename Cost>
+    int propagate(const Graph& graph, MinQueue& queue, std::vector<double>& dist, std::vector<int>& parent) {
+        const Node* nodes = graph.getNodes();
+        int improvements = 0;
+
+        while (!queue.empty()) {
+            auto [current, u] = queue.top();
+            queue.pop();
+            if (current > dist[u]) continue;
+
+            for (const Edge* edge = nodes[u].adjacencyList; edge != nullptr; edge = edge->next) {
+                int v = graph.findNodeIndex(edge->destination);
+                if (v == -1) continue;
+
+                double candidate = current + Cost::cost(*edge);
+                if (candidate < dist[v]) {
+                    dist[v] = candidate;
+                    parent[v] = u;
+                    queue.push({candidate, v});
+                    improvements++;
+                }
+            }
+        }
+        return improvements;
+    }
+
+    template <typename Cost>
+    void repairTree(const Graph& graph, const std::vector<std::pair<int, int>>& changes,
+                    std::vector<double>& dist, std::vector<int>& parent, std::vector<char>& affected,
+                    TreeRepairStats& stats) {
+        const Node* nodes = graph.getNodes();
+
+        // 1. A changed tree edge (u, v) invalidates v and everything below it.
+        //    Children of x are its out-neighbours whose parent is x; a removed
+        //    tree edge deeper down is itself in the change list.
+        std::vector<int> dropped;
+        std::vector<int> stack;
+        for (const auto& [sourceId, destId] : changes) {
+            int u = graph.findNodeIndex(sourceId);
+            int v = graph.findNodeIndex(destId);
+            if (u == -1 || v == -1 || parent[v] != u || affected[v]) continue;
+
+            affected[v] = 1;
+            stack.push_back(v);
+            while (!stack.empty()) {
+                int x = stack.back();
+                stack.pop_back();
+                dropped.push_back(x);
+                for (const Edge* edge = nodes[x].adjacencyList; edge != nullptr; edge = edge->next) {
+                    int w = graph.findNodeIndex(edge->destination);
+                    if (w != -1 && parent[w] == x && !affected[w]) {
+                        affected[w] = 1;
+                        stack.push_back(w);
+                    }
+                }
+            }
+        }
+        for (int x : dropped) {
+            dist[x] = UNREACHED;
+            parent[x] = -1;
+        }
+
+        // 2. Seeds: dropped nodes from their best unaffected in-neighbour ...
+        MinQueue queue;
+        for (int x : dropped) {
+            for (const Edge* in = nodes[x].incomingList; in != nullptr; in = in->next) {
+                int p = graph.findNodeIndex(in->destination);
+                if (p == -1 || affected[p] || dist[p] == UNREACHED) continue;
+
+                double candidate = dist[p] + Cost::cost(*in);
+                if (candidate < dist[x]) {
+                    dist[x] = candidate;
+                    parent[x] = p;
+                }
+            }
+            if (dist[x] != UNREACHED) {
+                queue.push({dist[x], x});
+            }
+        }
+
+        // ... and heads of changed edges that may now offer a shortcut
+        for (const auto& [sourceId, destId] : changes) {
+            int u = graph.findNodeIndex(sourceId);
+            int v = graph.findNodeIndex(destId);
+            if (u == -1 || v == -1 || affected[u] || affected[v] || dist[u] == UNREACHED) continue;
+
+            for (const Edge* edge = nodes[u].adjacencyList; edge != nullptr; edge = edge->next) {
+                if (edge->destination != destId) continue;
+                double candidate = dist[u] + Cost::cost(*edge);
+                if (candidate < dist[v]) {
+                    dist[v] = candidate;
+                    parent[v] = u;
+                    queue.push({candidate, v});
+                    stats.improvements++;
+                }
+                break;
+            }
+        }
+
+        // 3. Only the seeds' surroundings are searched
+        stats.improvements += propagate<Cost>(graph, queue, dist, parent);
+        stats.nodesInvalidated = (int)dropped.size();
+
+        for (int x : dropped) {
+            affected[x] = 0;
+        }
+    }
+}
+
+DynamicShortestPathTree::DynamicShortestPathTree()
+    : graph(nullptr), version(0), sourceId(-1), sourceSlot(-1), metric(CostMetric::DISTANCE),
+      built(false), viewStale(true) {}
+
+void DynamicShortestPathTree::build(const Graph& target, int source, CostMetric costMetric) {
+    graph = &target;
+    sourceId = source;
+    metric = costMetric;
+    built = true;
+
+    TreeRepairStats stats;
+    rebuild(stats);
+}
+
+void DynamicShortestPathTree::rebuild(TreeRepairStats& stats) {
+    int slotCount = graph->getMaxNodes();
+    dist.assign(slotCount, UNREACHED);
+    parent.assign(slotCount, -1);
+    affected.assign(slotCount, 0);
+    version = graph->getVersion();
+    sourceSlot = graph->findNodeIndex(sourceId);
+    viewStale = true;
+    stats.rebuilt = true;
+
+    if (sourceSlot == -1) {
+        return;
+    }
+
+    MinQueue queue;
+    dist[sourceSlot] = 0.0;
+    queue.push({0.0, sourceSlot});
+
+    switch (metric) {
+        case CostMetric::TIME:
+            stats.improvements = propagate<TimeCost>(*graph, queue, dist, parent);
+            break;
+        case CostMetric::TOLL:
+            stats.improvements = propagate<TollCost>(*graph, queue, dist, parent);
+            break;
+        case CostMetric::DISTANCE:
+        default:
+            stats.improvements = propagate<DistanceCost>(*graph, queue, dist, parent);
+            break;
+    }
+}
+
+void DynamicShortestPathTree::repair(const std::vector<std::pair<int, int>>& changes, TreeRepairStats& stats) {
+    // Nodes added since the last refresh get fresh, unreached slots
+    int slotCount = graph->getMaxNodes();
+    if ((int)dist.size() < slotCount) {
+        dist.resize(slotCount, UNREACHED);
+        parent.resize(slotCount, -1);
+        affected.resize(slotCount, 0);
+    }
+
+    switch (metric) {
+        case CostMetric::TIME:
+            repairTree<TimeCost>(*graph, changes, dist, parent, affected, stats);
+            break;
+        case CostMetric::TOLL:
+            repairTree<TollCost>(*graph, changes, dist, parent, affected, stats);
+            break;
+        case CostMetric::DISTANCE:
+        default:
+            repairTree<DistanceCost>(*graph, changes, dist, parent, affected, stats);
+            break;
+    }
+    version = graph->getVersion();
+    viewStale = true;
+}
+
+TreeRepairStats DynamicShortestPathTree::refresh(const Graph& target) {
+    TreeRepairStats stats;
+    if (!built) {
+        return stats;
+    }
+
+    if (graph != &target) {
+        graph = &target;
+        rebuild(stats);
+        return stats;
+    }
+    if (version == target.getVersion()) {
+        return stats;
+    }
+
+    std::vector<std::pair<int, int>> changes;
+    if (!target.getEdgeChangesSince(version, changes) || sourceSlot == -1 ||
+        target.findNodeIndex(sourceId) != sourceSlot) {
+        rebuild(stats);
+        stats.edgesChanged = (int)changes.size();
+        return stats;
+    }
+
+    stats.edgesChanged = (int)changes.size();
+    repair(changes, stats);
+    return stats;
+}
+
+double DynamicShortestPathTree::distanceTo(int nodeId) const {
+    if (!built) return UNREACHED;
+    int slot = graph->findNodeIndex(nodeId);
+    return slot == -1 || slot >= (int)dist.size() ? UNREACHED : dist[slot];
+}
+
+std::vector<int> DynamicShortestPathTree::pathTo(int nodeId) const {
+    std::vector<int> path;
+    if (distanceTo(nodeId) == UNREACHED) {
+        return path;
+    }
+
+    const Node* nodes = graph->getNodes();
+    for (int slot = graph->findNodeIndex(nodeId); slot != -1; slot = parent[slot]) {
+        path.push_back(nodes[slot].id);
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+const ShortestPathTree& DynamicShortestPathTree::getTree() {
+    if (!viewStale) {
+        return view;
+    }
+
+    view = ShortestPathTree();
+    view.sourceId = sourceId;
+    view.metric = metric;
+    view.radius = UNREACHED;
+    view.dist = dist;
+    view.prev.assign(dist.size(), -1);
+
+    const Node* nodes = graph->getNodes();
+    std::vector<int> reached;
+    for (int slot = 0; slot < (int)dist.size(); slot++) {
+        if (dist[slot] == UNREACHED) continue;
+        reached.push_back(slot);
+        if (parent[slot] != -1) view.prev[slot] = nodes[parent[slot]].id;
+    }
+    std::sort(reached.begin(), reached.end(), [this](int a, int b) {
+        return dist[a] < dist[b] || (dist[a] == dist[b] && a < b);
+    });
+    for (int slot : reached) {
+        view.order.push_back(nodes[slot].id);
+    }
+
+    viewStale = false;
+    return view;
+}
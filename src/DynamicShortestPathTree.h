@@ -0,0 +1,59 @@
+#ifndef DYNAMIC_SHORTEST_PATH_TREE_H
+#define DYNAMIC_SHORTEST_PATH_TREE_H
+
+#include <vector>
+#include "Algorithms.h"
+
+struct TreeRepairStats {
+    bool rebuilt;           // Full search instead of a repair
+    int edgesChanged;       // Journal entries consumed
+    int nodesInvalidated;   // Nodes whose tree path used a changed edge
+    int improvements;       // Distance decreases applied while repairing
+
+    TreeRepairStats() : rebuilt(false), edgesChanged(0), nodesInvalidated(0), improvements(0) {}
+};
+
+// One-to-all shortest path tree from a fixed source (e.g. a depot) that is
+// kept current across edge edits in the style of Ramalingam-Reps: refresh()
+// reads the graph's edge journal and
+//   1. drops the subtrees hanging below every changed tree edge,
+//   2. reseeds those nodes from their unaffected in-neighbours and the
+//      heads of changed non-tree edges from their tails,
+//   3. runs Dijkstra from the seeds only.
+// Nodes outside the dropped subtrees keep valid distances, so the work is
+// proportional to the part of the tree that actually moved. Node removal,
+// reloads or a journal overflow fall back to a full rebuild.
+class DynamicShortestPathTree {
+private:
+    const Graph* graph;
+    unsigned long long version;  // Graph version the tree reflects
+    int sourceId;
+    int sourceSlot;
+    CostMetric metric;
+    bool built;
+
+    std::vector<double> dist;    // Slot-indexed, infinity if unreached
+    std::vector<int> parent;     // Slot of the tree parent, -1 for the source and unreached nodes
+    std::vector<char> affected;  // Scratch marks for the dropped subtrees, all zero between repairs
+
+    ShortestPathTree view;       // Id-based copy for display, rebuilt on demand
+    bool viewStale;
+
+    void rebuild(TreeRepairStats& stats);
+    void repair(const std::vector<std::pair<int, int>>& changes, TreeRepairStats& stats);
+
+public:
+    DynamicShortestPathTree();
+
+    void build(const Graph& graph, int sourceId, CostMetric metric = CostMetric::DISTANCE);
+    TreeRepairStats refresh(const Graph& graph);  // No-op when the graph is unchanged
+
+    bool isBuilt() const { return built; }
+    int getSourceId() const { return sourceId; }
+    CostMetric getMetric() const { return metric; }
+    double distanceTo(int nodeId) const;      // Infinity if unreached or unknown
+    std::vector<int> pathTo(int nodeId) const;  // Node IDs from the source, empty if unreached
+    const ShortestPathTree& getTree();        // For displayShortestPathTree / treePath
+};
+
+#endif
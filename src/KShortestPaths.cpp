@@ -0,0 +1,175 @@
+#include "Algorithms.h"
+#include "SearchScratch.h"
+#include "utils/colors.h"
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <set>
+#include <vector>
+
+namespace {
+    // Distance Dijkstra from spurSlot that skips blocked slots and the edges
+    // spurSlot -> blockedHops[i]. The caller resets and blocks the scratch.
+    bool spurSearch(const Graph& graph, SearchScratch& scratch, int spurSlot, int destSlot,
+                    const std::vector<int>& blockedHops, std::vector<int>& pathSlots, double& cost) {
+        const Node* nodes = graph.getNodes();
+
+        scratch.relax(spurSlot, 0.0, -1);
+        while (!scratch.heap.empty()) {
+            auto [current, u] = scratch.pop();
+            if (scratch.isSettled(u)) continue;
+            scratch.settle(u);
+            if (u == destSlot) break;
+
+            for (const Edge* edge = nodes[u].adjacencyList; edge != nullptr; edge = edge->next) {
+                int v = graph.findNodeIndex(edge->destination);
+                if (v == -1 || scratch.isSettled(v) || scratch.isBlocked(v)) continue;
+                if (u == spurSlot) {
+                    bool removed = false;
+                    for (int hop : blockedHops) {
+                        if (hop == v) { removed = true; break; }
+                    }
+                    if (removed) continue;
+                }
+                scratch.relax(v, current + edge->weight, u);
+            }
+        }
+
+        if (!scratch.isSettled(destSlot)) {
+            return false;
+        }
+
+        cost = scratch.dist[destSlot];
+        pathSlots.clear();
+        for (int slot = destSlot; slot != -1; slot = scratch.prev[slot]) {
+            pathSlots.push_back(slot);
+        }
+        std::reverse(pathSlots.begin(), pathSlots.end());
+        return true;
+    }
+}
+
+// Yen's algorithm: each accepted route spawns one spur search per node,
+// with the shared root blocked so every candidate stays loopless.
+std::vector<PathResult> kShortestPaths(const Graph& graph, int sourceId, int destId, int k) {
+    std::vector<PathResult> routes;
+    int sourceSlot = graph.findNodeIndex(sourceId);
+    int destSlot = graph.findNodeIndex(destId);
+    if (sourceSlot == -1 || destSlot == -1 || k <= 0) {
+        return routes;
+    }
+
+    int slotCount = graph.getMaxNodes();
+    const Node* nodes = graph.getNodes();
+
+    struct Candidate {
+        double cost;
+        std::vector<int> slots;
+    };
+
+    SearchScratch scratch;  // Shared by every spur search below
+    std::vector<int> blockedHops;
+    std::vector<int> spurPath;
+    double spurCost = 0.0;
+
+    std::vector<Candidate> accepted;
+    std::vector<Candidate> candidates;
+    std::set<std::vector<int>> known;
+
+    scratch.reset(slotCount);
+    if (!spurSearch(graph, scratch, sourceSlot, destSlot, blockedHops, spurPath, spurCost)) {
+        return routes;
+    }
+    accepted.push_back({spurCost, spurPath});
+    known.insert(spurPath);
+
+    while ((int)accepted.size() < k) {
+        const std::vector<int> last = accepted.back().slots;
+        double rootCost = 0.0;
+
+        for (size_t i = 0; i + 1 < last.size(); i++) {
+            int spurSlot = last[i];
+
+            scratch.reset(slotCount);
+            for (size_t j = 0; j < i; j++) {
+                scratch.block(last[j]);
+            }
+
+            blockedHops.clear();
+            for (const Candidate& route : accepted) {
+                if (route.slots.size() > i + 1 &&
+                    std::equal(last.begin(), last.begin() + i + 1, route.slots.begin())) {
+                    blockedHops.push_back(route.slots[i + 1]);
+                }
+            }
+
+            if (spurSearch(graph, scratch, spurSlot, destSlot, blockedHops, spurPath, spurCost)) {
+                std::vector<int> slots(last.begin(), last.begin() + i);
+                slots.insert(slots.end(), spurPath.begin(), spurPath.end());
+                if (known.insert(slots).second) {
+                    candidates.push_back({rootCost + spurCost, std::move(slots)});
+                }
+            }
+
+            rootCost += graph.getEdgeWeight(nodes[last[i]].id, nodes[last[i + 1]].id);
+        }
+
+        if (candidates.empty()) {
+            break;
+        }
+
+        size_t best = 0;
+        for (size_t i = 1; i < candidates.size(); i++) {
+            if (candidates[i].cost < candidates[best].cost) best = i;
+        }
+        accepted.push_back(std::move(candidates[best]));
+        candidates[best] = std::move(candidates.back());
+        candidates.pop_back();
+    }
+
+    for (const Candidate& route : accepted) {
+        PathResult result;
+        result.found = true;
+        result.totalDistance = route.cost;
+        result.travelTimeMinutes = route.cost / DEFAULT_SPEED_KMH * 60.0;
+        for (int slot : route.slots) {
+            result.path.push_back(nodes[slot].id);
+        }
+        routes.push_back(result);
+    }
+    return routes;
+}
+
+void displayAlternatives(const Graph& graph, const std::vector<PathResult>& routes) {
+    system("cls");
+    std::cout << BOLD << "Alternative routes" << RESET << "\n";
+
+    if (routes.empty()) {
+        std::cout << "No path found between the nodes!\n";
+        std::cout << "The nodes may be disconnected.\n";
+        return;
+    }
+
+    std::cout << CYAN << routes.size() << " route(s) found\n" << RESET;
+    std::cout << "(at constant velocity of 60 km/h)\n\n";
+
+    double best = routes.front().totalDistance;
+    for (size_t i = 0; i < routes.size(); i++) {
+        const PathResult& route = routes[i];
+        std::cout << BOLD << "#" << (i + 1) << RESET << "  "
+                  << std::fixed << std::setprecision(2) << route.totalDistance << " km  "
+                  << std::setprecision(1) << route.travelTimeMinutes << " min";
+        if (i > 0 && best > 0) {
+            std::cout << GRAY << "  (+" << (route.totalDistance - best) / best * 100.0 << "%)" << RESET;
+        }
+        std::cout << "\n    ";
+
+        for (size_t j = 0; j < route.path.size(); j++) {
+            std::cout << "[" << route.path[j] << "] " << graph.getNodeName(route.path[j]);
+            if (j < route.path.size() - 1) {
+                std::cout << " -> ";
+            }
+        }
+        std::cout << "\n\n";
+    }
+}
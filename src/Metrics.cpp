@@ -0,0 +1,131 @@
+#include "Metrics.h"
+#include <bit>
+
+const char* operationName(Operation operation) {
+    switch (operation) {
+        case Operation::DIJKSTRA:       return "dijkstra";
+        case Operation::ROUTE:          return "route";
+        case Operation::BFS:            return "bfs";
+        case Operation::DFS:            return "dfs";
+        case Operation::VEHICLE_ADD:    return "vehicle_add";
+        case Operation::VEHICLE_SEARCH: return "vehicle_search";
+        case Operation::VEHICLE_REMOVE: return "vehicle_remove";
+        case Operation::NETWORK_LOAD:   return "network_load";
+        case Operation::VEHICLE_LOAD:   return "vehicle_load";
+        case Operation::TELEMETRY_BATCH: return "telemetry_batch";
+        default:                        return "unknown";
+    }
+}
+
+const char* counterName(Counter counter) {
+    switch (counter) {
+        case Counter::NODES_SETTLED: return "nodes_settled";
+        case Counter::EDGES_RELAXED: return "edges_relaxed";
+        case Counter::QUEUE_PUSHES:  return "queue_pushes";
+        default:                     return "unknown";
+    }
+}
+
+unsigned sampleInterval(Operation operation) {
+    switch (operation) {
+        case Operation::VEHICLE_SEARCH:
+            return SAMPLE_INTERVAL;
+        default:
+            return 1;
+    }
+}
+
+LatencyHistogram::LatencyHistogram() : count(0), sum(0), max(0) {
+    for (auto& bucket : buckets) bucket.store(0, std::memory_order_relaxed);
+}
+
+// Bucket index: the top bit picks the power of two, the next four bits the sub-bucket
+int LatencyHistogram::bucketOf(unsigned long long value) {
+    if (value < SUB_BUCKETS) {
+        return (int)value;
+    }
+    int exponent = std::bit_width(value) - 1;  // >= 4
+    int sub = (int)(value >> (exponent - 4)) - SUB_BUCKETS;
+    return SUB_BUCKETS + (exponent - 4) * SUB_BUCKETS + sub;
+}
+
+unsigned long long LatencyHistogram::bucketUpperBound(int bucket) {
+    if (bucket < SUB_BUCKETS) {
+        return (unsigned long long)bucket;
+    }
+    int exponent = (bucket - SUB_BUCKETS) / SUB_BUCKETS + 4;
+    unsigned long long sub = (unsigned long long)((bucket - SUB_BUCKETS) % SUB_BUCKETS);
+    unsigned long long width = 1ULL << (exponent - 4);
+    return (SUB_BUCKETS + sub) * width + (width - 1);
+}
+
+void LatencyHistogram::record(unsigned long long nanos) {
+    buckets[bucketOf(nanos)].fetch_add(1, std::memory_order_relaxed);
+    count.fetch_add(1, std::memory_order_relaxed);
+    sum.fetch_add(nanos, std::memory_order_relaxed);
+
+    unsigned long long seen = max.load(std::memory_order_relaxed);
+    while (nanos > seen && !max.compare_exchange_weak(seen, nanos, std::memory_order_relaxed)) {
+    }
+}
+
+void LatencyHistogram::reset() {
+    for (auto& bucket : buckets) bucket.store(0, std::memory_order_relaxed);
+    count.store(0, std::memory_order_relaxed);
+    sum.store(0, std::memory_order_relaxed);
+    max.store(0, std::memory_order_relaxed);
+}
+
+double LatencyHistogram::getMean() const {
+    unsigned long long samples = getCount();
+    return samples == 0 ? 0.0 : (double)sum.load(std::memory_order_relaxed) / samples;
+}
+
+// Concurrent recording can make the bucket total differ slightly from count;
+// the walk uses the buckets' own total so it always lands on a bucket
+unsigned long long LatencyHistogram::percentile(double percent) const {
+    unsigned long long total = 0;
+    for (const auto& bucket : buckets) total += bucket.load(std::memory_order_relaxed);
+    if (total == 0) {
+        return 0;
+    }
+
+    unsigned long long rank = (unsigned long long)(percent / 100.0 * total + 0.5);
+    if (rank < 1) rank = 1;
+    if (rank > total) rank = total;
+
+    unsigned long long seen = 0;
+    for (int bucket = 0; bucket < BUCKET_COUNT; bucket++) {
+        seen += buckets[bucket].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            unsigned long long bound = bucketUpperBound(bucket);
+            return bound < getMax() ? bound : getMax();
+        }
+    }
+    return getMax();
+}
+
+Metrics::Metrics() {
+    for (auto& operation : counters) {
+        for (auto& counter : operation) counter.store(0, std::memory_order_relaxed);
+    }
+    for (auto& count : calls) count.store(0, std::memory_order_relaxed);
+}
+
+void Metrics::reset() {
+    for (int operation = 0; operation < OPERATION_COUNT; operation++) {
+        latency[operation].reset();
+        for (auto& counter : counters[operation]) counter.store(0, std::memory_order_relaxed);
+        calls[operation].store(0, std::memory_order_relaxed);
+    }
+}
+
+unsigned long long Metrics::getCallCount(Operation operation) const {
+    return sampleInterval(operation) > 1 ? calls[(int)operation].load(std::memory_order_relaxed)
+                                         : latency[(int)operation].getCount();
+}
+
+Metrics& metrics() {
+    static Metrics instance;
+    return instance;
+}
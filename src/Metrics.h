@@ -0,0 +1,135 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <atomic>
+#include <chrono>
+
+// Instrumented operations; each gets its own latency histogram and counters
+enum class Operation {
+    DIJKSTRA,
+    ROUTE,            // findRoute (vehicle moves)
+    BFS,
+    DFS,
+    VEHICLE_ADD,
+    VEHICLE_SEARCH,
+    VEHICLE_REMOVE,
+    NETWORK_LOAD,
+    VEHICLE_LOAD,
+    TELEMETRY_BATCH,  // One ingest batch parsed and applied
+    COUNT
+};
+
+enum class Counter {
+    NODES_SETTLED,    // Nodes finalized / visited
+    EDGES_RELAXED,    // Edges examined
+    QUEUE_PUSHES,     // Heap, queue or stack insertions
+    COUNT
+};
+
+const int OPERATION_COUNT = (int)Operation::COUNT;
+const int COUNTER_COUNT = (int)Counter::COUNT;
+
+const char* operationName(Operation operation);
+const char* counterName(Counter counter);
+
+// A registry search takes tens of nanoseconds, less than two clock reads,
+// so only one search in SAMPLE_INTERVAL is timed. Adds and removes print
+// and may rewrite the registry file, so every one of them is timed.
+const unsigned SAMPLE_INTERVAL = 64;
+unsigned sampleInterval(Operation operation);  // 1 for operations timed on every call
+
+// Log-linear latency histogram in the style of HdrHistogram: values below
+// 16 ns get exact buckets, every power of two above that is split into 16
+// linear sub-buckets, so any reported value is within 6.25% of the true
+// one. Recording is a handful of relaxed atomic adds and never locks, so
+// it is safe from any number of threads.
+class LatencyHistogram {
+public:
+    static const int SUB_BUCKETS = 16;
+    static const int BUCKET_COUNT = SUB_BUCKETS + (64 - 4) * SUB_BUCKETS;
+
+    LatencyHistogram();
+
+    void record(unsigned long long nanos);
+    void reset();
+
+    unsigned long long getCount() const { return count.load(std::memory_order_relaxed); }
+    unsigned long long getMax() const { return max.load(std::memory_order_relaxed); }
+    double getMean() const;
+    unsigned long long percentile(double percent) const;  // Upper bound of the bucket holding it
+
+    // Raw buckets, for export
+    unsigned long long getBucketCount(int bucket) const { return buckets[bucket].load(std::memory_order_relaxed); }
+    static unsigned long long bucketUpperBound(int bucket);
+
+private:
+    std::atomic<unsigned long long> buckets[BUCKET_COUNT];
+    std::atomic<unsigned long long> count;
+    std::atomic<unsigned long long> sum;
+    std::atomic<unsigned long long> max;
+
+    static int bucketOf(unsigned long long value);
+};
+
+class Metrics {
+private:
+    LatencyHistogram latency[OPERATION_COUNT];
+    std::atomic<unsigned long long> counters[OPERATION_COUNT][COUNTER_COUNT];
+    std::atomic<unsigned long long> calls[OPERATION_COUNT];  // Every call of sampled operations
+
+public:
+    Metrics();
+
+    void record(Operation operation, unsigned long long nanos) { latency[(int)operation].record(nanos); }
+    void add(Operation operation, Counter counter, unsigned long long amount) {
+        counters[(int)operation][(int)counter].fetch_add(amount, std::memory_order_relaxed);
+    }
+
+    void countCall(Operation operation) { calls[(int)operation].fetch_add(1, std::memory_order_relaxed); }
+
+    const LatencyHistogram& getLatency(Operation operation) const { return latency[(int)operation]; }
+    // Exact: the call counter for sampled operations, the histogram count otherwise
+    unsigned long long getCallCount(Operation operation) const;
+    unsigned long long getCounter(Operation operation, Counter counter) const {
+        return counters[(int)operation][(int)counter].load(std::memory_order_relaxed);
+    }
+
+    void reset();
+};
+
+Metrics& metrics();  // Process-wide instance
+
+// True for the calls that should be timed. Every call is counted exactly;
+// the countdown is per thread so it needs no synchronization
+inline bool shouldSample(Operation operation) {
+    metrics().countCall(operation);
+    thread_local unsigned calls[OPERATION_COUNT] = {};
+    return calls[(int)operation]++ % SAMPLE_INTERVAL == 0;
+}
+
+// Records the lifetime of the enclosing scope; inactive timers cost nothing
+class ScopedTimer {
+private:
+    Operation operation;
+    bool active;
+    std::chrono::steady_clock::time_point start;
+
+public:
+    explicit ScopedTimer(Operation operation, bool active = true)
+        : operation(operation), active(active) {
+        if (active) start = std::chrono::steady_clock::now();
+    }
+
+    ~ScopedTimer() {
+        if (active) {
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            metrics().record(operation, (unsigned long long)
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        }
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+};
+
+#endif
@@ -0,0 +1,114 @@
+#include "Algorithms.h"
+#include "CostPolicies.h"
+#include "Metrics.h"
+#include <limits>
+#include <queue>
+#include <vector>
+#include <functional>
+
+namespace {
+    // Heap-based Dijkstra; Restricted = false compiles the class check out entirely
+    template <typename Cost, bool Restricted>
+    PathResult routeKernel(const Graph& graph, int sourceIndex, int destIndex, unsigned char vehicleClass) {
+        PathResult result;
+        const double inf = std::numeric_limits<double>::infinity();
+        int slotCount = graph.getMaxNodes();
+        const Node* nodes = graph.getNodes();
+
+        std::vector<double> cost(slotCount, inf);
+        std::vector<int> prev(slotCount, -1);
+        std::vector<const Edge*> prevEdge(slotCount, nullptr);
+        std::vector<bool> settled(slotCount, false);
+
+        typedef std::pair<double, int> QueueEntry;
+        std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> queue;
+
+        unsigned long long settledCount = 0;
+        unsigned long long edgesRelaxed = 0;
+        unsigned long long pushes = 1;
+
+        cost[sourceIndex] = 0.0;
+        queue.push({0.0, sourceIndex});
+
+        while (!queue.empty()) {
+            auto [current, u] = queue.top();
+            queue.pop();
+
+            if (settled[u]) continue;
+            settled[u] = true;
+            settledCount++;
+            if (u == destIndex) break;
+
+            for (const Edge* edge = nodes[u].adjacencyList; edge != nullptr; edge = edge->next) {
+                if constexpr (Restricted) {
+                    if (edge->restrictions & vehicleClass) continue;
+                }
+
+                int v = graph.findNodeIndex(edge->destination);
+                edgesRelaxed++;
+                if (v == -1 || settled[v]) continue;
+
+                double candidate = current + Cost::cost(*edge);
+                if (candidate < cost[v]) {
+                    cost[v] = candidate;
+                    prev[v] = u;
+                    prevEdge[v] = edge;
+                    queue.push({candidate, v});
+                    pushes++;
+                }
+            }
+        }
+
+        metrics().add(Operation::ROUTE, Counter::NODES_SETTLED, settledCount);
+        metrics().add(Operation::ROUTE, Counter::EDGES_RELAXED, edgesRelaxed);
+        metrics().add(Operation::ROUTE, Counter::QUEUE_PUSHES, pushes);
+
+        if (cost[destIndex] == inf) {
+            return result;
+        }
+
+        // Report every criterion along the chosen path, whatever was minimized
+        result.found = true;
+        std::vector<int> reversePath;
+        for (int slot = destIndex; slot != -1; slot = prev[slot]) {
+            reversePath.push_back(nodes[slot].id);
+            if (prevEdge[slot] != nullptr) {
+                result.totalDistance += prevEdge[slot]->weight;
+                result.travelTimeMinutes += TimeCost::cost(*prevEdge[slot]);
+                result.totalToll += prevEdge[slot]->toll;
+            }
+        }
+        result.path.assign(reversePath.rbegin(), reversePath.rend());
+        return result;
+    }
+
+    template <typename Cost>
+    PathResult dispatchRestriction(const Graph& graph, int sourceIndex, int destIndex, unsigned char vehicleClass) {
+        if (vehicleClass == VEHICLE_CLASS_NONE) {
+            return routeKernel<Cost, false>(graph, sourceIndex, destIndex, vehicleClass);
+        }
+        return routeKernel<Cost, true>(graph, sourceIndex, destIndex, vehicleClass);
+    }
+}
+
+PathResult findRoute(const Graph& graph, int sourceId, int destId, CostMetric metric,
+                     const std::string& vehicleType) {
+    ScopedTimer timer(Operation::ROUTE);
+    int sourceIndex = graph.findNodeIndex(sourceId);
+    int destIndex = graph.findNodeIndex(destId);
+    if (sourceIndex == -1 || destIndex == -1) {
+        return PathResult();
+    }
+
+    unsigned char vehicleClass = vehicleClassFromType(vehicleType);
+
+    switch (metric) {
+        case CostMetric::TIME:
+            return dispatchRestriction<TimeCost>(graph, sourceIndex, destIndex, vehicleClass);
+        case CostMetric::TOLL:
+            return dispatchRestriction<TollCost>(graph, sourceIndex, destIndex, vehicleClass);
+        case CostMetric::DISTANCE:
+        default:
+            return dispatchRestriction<DistanceCost>(graph, sourceIndex, destIndex, vehicleClass);
+    }
+}
@@ -0,0 +1,162 @@
+#include "Algorithms.h"
+#include "RoutingSnapshot.h"
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <thread>
+#include <vector>
+
+namespace {
+    const int TOP_DOWN_ALPHA = 14;        // Go bottom-up once frontier edges exceed unexplored edges / alpha
+    const int BOTTOM_UP_BETA = 24;        // Return top-down once the frontier drops below nodes / beta
+    const int FRONTIER_CHUNK = 256;       // Frontier entries claimed at a time (top-down)
+    const int BITMAP_CHUNK_WORDS = 64;    // Bitmap words claimed at a time (bottom-up), 4096 nodes
+    const int PARALLEL_MIN_NODES = 16384; // Smaller graphs run on the calling thread only
+
+    // One bit per dense index; bits are only ever set during a traversal
+    struct Bitmap {
+        std::vector<std::atomic<unsigned long long>> words;
+
+        explicit Bitmap(int bits) : words((bits + 63) / 64) {}
+
+        bool test(int index) const {
+            return (words[index >> 6].load(std::memory_order_relaxed) >> (index & 63)) & 1ULL;
+        }
+
+        // True if this call set the bit
+        bool trySet(int index) {
+            unsigned long long bit = 1ULL << (index & 63);
+            return (words[index >> 6].fetch_or(bit, std::memory_order_relaxed) & bit) == 0;
+        }
+
+        void clear() {
+            for (auto& word : words) word.store(0, std::memory_order_relaxed);
+        }
+    };
+}
+
+// Level-synchronous BFS that switches between top-down expansion (scan the
+// frontier's out-edges) and bottom-up expansion (each unvisited node scans
+// its in-edges for a frontier parent) depending on which touches fewer
+// edges. Threads share each level through a barrier; the barrier's
+// completion step merges their discoveries and picks the next direction.
+TraversalResult parallelBfs(const RoutingSnapshot& snapshot, int startId, int threadCount) {
+    TraversalResult result;
+    int start = snapshot.indexOf(startId);
+    if (start == -1) {
+        return result;
+    }
+
+    int nodeCount = snapshot.nodeCount;
+    if (threadCount <= 0) {
+        threadCount = nodeCount < PARALLEL_MIN_NODES ? 1 : (int)std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    Bitmap visited(nodeCount);
+    Bitmap frontierBits(nodeCount);
+    std::vector<int> frontier = {start};
+    std::vector<std::vector<int>> discovered(threadCount);
+    std::atomic<int> cursor(0);
+
+    visited.trySet(start);
+    result.visitedNodes.push_back(startId);
+    result.levels.push_back(0);
+
+    auto outDegree = [&](int node) { return snapshot.outOffsets[node + 1] - snapshot.outOffsets[node]; };
+
+    int depth = 0;
+    bool bottomUp = false;
+    bool done = false;
+    long long unexploredEdges = snapshot.edgeCount - outDegree(start);
+
+    auto finishLevel = [&]() noexcept {
+        frontier.clear();
+        for (std::vector<int>& found : discovered) {
+            frontier.insert(frontier.end(), found.begin(), found.end());
+            found.clear();
+        }
+
+        depth++;
+        long long frontierEdges = 0;
+        for (int node : frontier) {
+            result.visitedNodes.push_back(snapshot.nodeIds[node]);
+            result.levels.push_back(depth);
+            frontierEdges += outDegree(node);
+        }
+        unexploredEdges -= frontierEdges;
+
+        if (!bottomUp && frontierEdges > unexploredEdges / TOP_DOWN_ALPHA) {
+            bottomUp = true;
+        } else if (bottomUp && (long long)frontier.size() < nodeCount / BOTTOM_UP_BETA) {
+            bottomUp = false;
+        }
+
+        if (bottomUp) {
+            frontierBits.clear();
+            for (int node : frontier) frontierBits.trySet(node);
+        }
+
+        cursor.store(0, std::memory_order_relaxed);
+        done = frontier.empty();
+    };
+
+    std::barrier levelSync(threadCount, finishLevel);
+
+    auto worker = [&](int thread) {
+        std::vector<int>& found = discovered[thread];
+        int wordCount = (int)visited.words.size();
+
+        while (!done) {
+            if (!bottomUp) {
+                int size = (int)frontier.size();
+                for (int begin = cursor.fetch_add(FRONTIER_CHUNK); begin < size;
+                     begin = cursor.fetch_add(FRONTIER_CHUNK)) {
+                    int end = std::min(begin + FRONTIER_CHUNK, size);
+                    for (int i = begin; i < end; i++) {
+                        int node = frontier[i];
+                        for (int e = snapshot.outOffsets[node]; e < snapshot.outOffsets[node + 1]; e++) {
+                            int target = snapshot.outTargets[e];
+                            if (!visited.test(target) && visited.trySet(target)) {
+                                found.push_back(target);
+                            }
+                        }
+                    }
+                }
+            } else {
+                // Chunks are whole bitmap words, so only this thread sets these bits
+                for (int word = cursor.fetch_add(BITMAP_CHUNK_WORDS); word < wordCount;
+                     word = cursor.fetch_add(BITMAP_CHUNK_WORDS)) {
+                    int end = std::min((word + BITMAP_CHUNK_WORDS) * 64, nodeCount);
+                    for (int node = word * 64; node < end; node++) {
+                        if (visited.test(node)) continue;
+                        for (int e = snapshot.inOffsets[node]; e < snapshot.inOffsets[node + 1]; e++) {
+                            if (frontierBits.test(snapshot.inSources[e])) {
+                                visited.trySet(node);
+                                found.push_back(node);
+                                break;
+                            }
+                        }
+                    }
+                }
+            }
+            levelSync.arrive_and_wait();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int t = 1; t < threadCount; t++) {
+        threads.emplace_back(worker, t);
+    }
+    worker(0);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    result.completed = true;
+    return result;
+}
+
+TraversalResult parallelBfs(const Graph& graph, int startId, int threadCount) {
+    RoutingSnapshot snapshot(graph);
+    return parallelBfs(snapshot, startId, threadCount);
+}
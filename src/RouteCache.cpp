@@ -0,0 +1,76 @@
+#include "RouteCache.h"
+#include "models/VehicleClass.h"
+
+RouteCache::RouteCache(size_t capacity)
+    : capacity(capacity), graph(nullptr), graphVersion(0),
+      hits(0), misses(0), evictions(0), invalidations(0) {}
+
+size_t RouteCache::KeyHash::operator()(const Key& key) const {
+    unsigned long long packed = ((unsigned long long)(unsigned)key.sourceId << 32) | (unsigned)key.destId;
+    packed ^= ((unsigned long long)key.metric << 8 | key.vehicleClass) * 0x9E3779B97F4A7C15ULL;
+    packed ^= packed >> 31;
+    packed *= 0xBF58476D1CE4E5B9ULL;
+    packed ^= packed >> 29;
+    return (size_t)packed;
+}
+
+void RouteCache::validate(const Graph& current) {
+    if (graph == &current && graphVersion == current.getVersion()) {
+        return;
+    }
+    if (!entries.empty()) {
+        invalidations++;
+    }
+    entries.clear();
+    index.clear();
+    graph = &current;
+    graphVersion = current.getVersion();
+}
+
+void RouteCache::evictToCapacity() {
+    while (entries.size() > capacity) {
+        index.erase(entries.back().key);
+        entries.pop_back();
+        evictions++;
+    }
+}
+
+PathResult RouteCache::route(const Graph& current, int sourceId, int destId, CostMetric metric,
+                             const std::string& vehicleType) {
+    validate(current);
+
+    Key key{sourceId, destId, metric, vehicleClassFromType(vehicleType)};
+    auto found = index.find(key);
+    if (found != index.end()) {
+        hits++;
+        entries.splice(entries.begin(), entries, found->second);
+        return found->second->result;
+    }
+
+    misses++;
+    PathResult result = findRoute(current, sourceId, destId, metric, vehicleType);
+    if (capacity == 0) {
+        return result;
+    }
+
+    entries.push_front({key, result});
+    index[key] = entries.begin();
+    evictToCapacity();
+    return result;
+}
+
+void RouteCache::clear() {
+    entries.clear();
+    index.clear();
+    hits = misses = evictions = invalidations = 0;
+}
+
+void RouteCache::setCapacity(size_t newCapacity) {
+    capacity = newCapacity;
+    evictToCapacity();
+}
+
+double RouteCache::getHitRate() const {
+    unsigned long long lookups = hits + misses;
+    return lookups == 0 ? 0.0 : (double)hits / lookups;
+}
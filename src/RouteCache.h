@@ -0,0 +1,73 @@
+#ifndef ROUTE_CACHE_H
+#define ROUTE_CACHE_H
+
+#include <list>
+#include <string>
+#include <unordered_map>
+#include "Algorithms.h"
+
+// Bounded LRU cache of findRoute results for one Graph. Entries are only
+// valid for the graph version they were computed on: any mutation (weights
+// included) bumps Graph::getVersion() and the next lookup drops the whole
+// cache, so a hit is always the exact answer findRoute would give now.
+// Routes depend on the vehicle type only through its class, so vehicles of
+// the same class share entries.
+class RouteCache {
+public:
+    static const size_t DEFAULT_CAPACITY = 1024;
+
+    explicit RouteCache(size_t capacity = DEFAULT_CAPACITY);
+
+    // Cached findRoute; computes and stores the result on a miss
+    PathResult route(const Graph& graph, int sourceId, int destId, CostMetric metric,
+                     const std::string& vehicleType = "");
+
+    void clear();
+    void setCapacity(size_t capacity);  // Evicts down to the new size
+
+    size_t getSize() const { return entries.size(); }
+    size_t getCapacity() const { return capacity; }
+    unsigned long long getHits() const { return hits; }
+    unsigned long long getMisses() const { return misses; }
+    unsigned long long getEvictions() const { return evictions; }
+    unsigned long long getInvalidations() const { return invalidations; }  // Flushes caused by graph edits
+    double getHitRate() const;  // 0..1, 0 before any lookup
+
+private:
+    struct Key {
+        int sourceId;
+        int destId;
+        CostMetric metric;
+        unsigned char vehicleClass;
+
+        bool operator==(const Key& other) const {
+            return sourceId == other.sourceId && destId == other.destId &&
+                   metric == other.metric && vehicleClass == other.vehicleClass;
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+
+    struct Entry {
+        Key key;
+        PathResult result;
+    };
+
+    size_t capacity;
+    const Graph* graph;                 // Graph the entries were computed on
+    unsigned long long graphVersion;
+    std::list<Entry> entries;           // Most recently used first
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index;
+
+    unsigned long long hits;
+    unsigned long long misses;
+    unsigned long long evictions;
+    unsigned long long invalidations;
+
+    void validate(const Graph& graph);
+    void evictToCapacity();
+};
+
+#endif
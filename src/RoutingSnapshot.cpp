@@ -0,0 +1,240 @@
+#include "RoutingSnapshot.h"
+#include <algorithm>
+#include <cstdlib>
+#include <numeric>
+
+namespace {
+    const int HILBERT_BITS = 16;  // Positions are quantized to a 65536 x 65536 grid
+
+    // Undirected neighbor lists over insertion-order indices, used only to pick an order
+    struct Neighborhood {
+        std::vector<int> offsets;
+        std::vector<int> targets;
+
+        int degree(int node) const { return offsets[node + 1] - offsets[node]; }
+    };
+
+    Neighborhood undirectedNeighbors(const Graph& graph, const std::vector<int>& slots,
+                                     const std::vector<int>& denseBySlot) {
+        const Node* nodes = graph.getNodes();
+        int nodeCount = (int)slots.size();
+
+        Neighborhood adjacency;
+        adjacency.offsets.assign(nodeCount + 1, 0);
+        for (int i = 0; i < nodeCount; i++) {
+            const Node& node = nodes[slots[i]];
+            adjacency.offsets[i + 1] = adjacency.offsets[i] + node.outDegree + node.inDegree;
+        }
+
+        adjacency.targets.resize(adjacency.offsets[nodeCount]);
+        for (int i = 0; i < nodeCount; i++) {
+            const Node& node = nodes[slots[i]];
+            int position = adjacency.offsets[i];
+            for (const Edge* edge = node.adjacencyList; edge != nullptr; edge = edge->next) {
+                adjacency.targets[position++] = denseBySlot[graph.findNodeIndex(edge->destination)];
+            }
+            for (const Edge* edge = node.incomingList; edge != nullptr; edge = edge->next) {
+                adjacency.targets[position++] = denseBySlot[graph.findNodeIndex(edge->destination)];
+            }
+        }
+        return adjacency;
+    }
+
+    // Breadth-first numbering, one tree per component, each rooted at its
+    // lowest-degree node. With byDegree each node's newly placed neighbors
+    // are sorted by ascending degree (Cuthill-McKee).
+    std::vector<int> breadthFirstOrder(const Neighborhood& adjacency, bool byDegree) {
+        int nodeCount = (int)adjacency.offsets.size() - 1;
+        auto lowerDegree = [&](int a, int b) {
+            int degreeA = adjacency.degree(a);
+            int degreeB = adjacency.degree(b);
+            return degreeA != degreeB ? degreeA < degreeB : a < b;
+        };
+
+        std::vector<int> roots(nodeCount);
+        std::iota(roots.begin(), roots.end(), 0);
+        std::sort(roots.begin(), roots.end(), lowerDegree);
+
+        std::vector<char> placed(nodeCount, 0);
+        std::vector<int> sequence;
+        sequence.reserve(nodeCount);
+
+        for (int root : roots) {
+            if (placed[root]) continue;
+            placed[root] = 1;
+            sequence.push_back(root);
+
+            for (size_t head = sequence.size() - 1; head < sequence.size(); head++) {
+                int node = sequence[head];
+                size_t firstNew = sequence.size();
+                for (int e = adjacency.offsets[node]; e < adjacency.offsets[node + 1]; e++) {
+                    int target = adjacency.targets[e];
+                    if (!placed[target]) {
+                        placed[target] = 1;
+                        sequence.push_back(target);
+                    }
+                }
+                if (byDegree) {
+                    std::sort(sequence.begin() + firstNew, sequence.end(), lowerDegree);
+                }
+            }
+        }
+        return sequence;
+    }
+
+    // Distance along the Hilbert curve of order HILBERT_BITS
+    unsigned long long hilbertIndex(unsigned x, unsigned y) {
+        const unsigned side = 1u << HILBERT_BITS;
+        unsigned long long index = 0;
+        for (unsigned s = side >> 1; s > 0; s >>= 1) {
+            unsigned rx = (x & s) ? 1 : 0;
+            unsigned ry = (y & s) ? 1 : 0;
+            index += (unsigned long long)s * s * ((3 * rx) ^ ry);
+            if (ry == 0) {  // Rotate the quadrant so the curve stays continuous
+                if (rx == 1) {
+                    x = side - 1 - x;
+                    y = side - 1 - y;
+                }
+                std::swap(x, y);
+            }
+        }
+        return index;
+    }
+
+    std::vector<int> hilbertOrder(const Graph& graph, const std::vector<int>& slots) {
+        const Node* nodes = graph.getNodes();
+        int nodeCount = (int)slots.size();
+
+        double minX = 0.0, maxX = 0.0, minY = 0.0, maxY = 0.0;
+        for (int i = 0; i < nodeCount; i++) {
+            const Node& node = nodes[slots[i]];
+            if (i == 0 || node.x < minX) minX = node.x;
+            if (i == 0 || node.x > maxX) maxX = node.x;
+            if (i == 0 || node.y < minY) minY = node.y;
+            if (i == 0 || node.y > maxY) maxY = node.y;
+        }
+
+        // One scale for both axes keeps the curve's cells square
+        double extent = std::max(maxX - minX, maxY - minY);
+        double scale = extent > 0.0 ? ((1u << HILBERT_BITS) - 1) / extent : 0.0;
+
+        std::vector<unsigned long long> keys(nodeCount);
+        for (int i = 0; i < nodeCount; i++) {
+            const Node& node = nodes[slots[i]];
+            keys[i] = hilbertIndex((unsigned)((node.x - minX) * scale), (unsigned)((node.y - minY) * scale));
+        }
+
+        std::vector<int> sequence(nodeCount);
+        std::iota(sequence.begin(), sequence.end(), 0);
+        std::stable_sort(sequence.begin(), sequence.end(), [&](int a, int b) { return keys[a] < keys[b]; });
+        return sequence;
+    }
+}
+
+const char* nodeOrderName(NodeOrder order) {
+    switch (order) {
+        case NodeOrder::BFS:     return "BFS";
+        case NodeOrder::RCM:     return "RCM";
+        case NodeOrder::HILBERT: return "Hilbert";
+        default:                 return "Insertion";
+    }
+}
+
+RoutingSnapshot::RoutingSnapshot(const Graph& graph, NodeOrder order)
+    : nodeCount(0), edgeCount(0), graphVersion(graph.getVersion()), order(order) {
+    const Node* nodes = graph.getNodes();
+    int slotCount = graph.getMaxNodes();
+
+    std::vector<int> slots;  // Dense index -> node slot
+    slots.reserve(graph.getNodeCount());
+    bool allPositioned = true;
+    for (int i = 0; i < slotCount; i++) {
+        if (nodes[i].active) {
+            slots.push_back(i);
+            allPositioned = allPositioned && nodes[i].hasPosition;
+        }
+    }
+    nodeCount = (int)slots.size();
+
+    if (this->order == NodeOrder::HILBERT && !allPositioned) {
+        this->order = NodeOrder::BFS;
+    }
+
+    if (this->order != NodeOrder::INSERTION && nodeCount > 0) {
+        std::vector<int> sequence;
+        if (this->order == NodeOrder::HILBERT) {
+            sequence = hilbertOrder(graph, slots);
+        } else {
+            std::vector<int> denseBySlot(slotCount, -1);
+            for (int i = 0; i < nodeCount; i++) denseBySlot[slots[i]] = i;
+
+            Neighborhood adjacency = undirectedNeighbors(graph, slots, denseBySlot);
+            sequence = breadthFirstOrder(adjacency, this->order == NodeOrder::RCM);
+            if (this->order == NodeOrder::RCM) {
+                std::reverse(sequence.begin(), sequence.end());
+            }
+        }
+
+        std::vector<int> reordered(nodeCount);
+        for (int i = 0; i < nodeCount; i++) reordered[i] = slots[sequence[i]];
+        slots.swap(reordered);
+    }
+
+    nodeIds.reserve(nodeCount);
+    for (int i = 0; i < nodeCount; i++) {
+        indexById[nodes[slots[i]].id] = i;
+        nodeIds.push_back(nodes[slots[i]].id);
+    }
+
+    // Degree counters give the offsets up front, so each array is filled once
+    outOffsets.assign(nodeCount + 1, 0);
+    inOffsets.assign(nodeCount + 1, 0);
+    for (int i = 0; i < nodeCount; i++) {
+        const Node& node = nodes[slots[i]];
+        outOffsets[i + 1] = outOffsets[i] + node.outDegree;
+        inOffsets[i + 1] = inOffsets[i] + node.inDegree;
+    }
+    edgeCount = outOffsets[nodeCount];
+
+    outTargets.resize(edgeCount);
+    outWeights.resize(edgeCount);
+    inSources.resize(inOffsets[nodeCount]);
+
+    for (int i = 0; i < nodeCount; i++) {
+        const Node& node = nodes[slots[i]];
+
+        int position = outOffsets[i];
+        for (const Edge* edge = node.adjacencyList; edge != nullptr; edge = edge->next) {
+            outTargets[position] = indexById[edge->destination];
+            outWeights[position] = edge->weight;
+            position++;
+        }
+
+        position = inOffsets[i];
+        for (const Edge* edge = node.incomingList; edge != nullptr; edge = edge->next) {
+            inSources[position++] = indexById[edge->destination];
+        }
+    }
+}
+
+int RoutingSnapshot::bandwidth() const {
+    int widest = 0;
+    for (int node = 0; node < nodeCount; node++) {
+        for (int e = outOffsets[node]; e < outOffsets[node + 1]; e++) {
+            widest = std::max(widest, std::abs(outTargets[e] - node));
+        }
+    }
+    return widest;
+}
+
+double RoutingSnapshot::averageEdgeSpan() const {
+    if (edgeCount == 0) return 0.0;
+
+    long long total = 0;
+    for (int node = 0; node < nodeCount; node++) {
+        for (int e = outOffsets[node]; e < outOffsets[node + 1]; e++) {
+            total += std::abs(outTargets[e] - node);
+        }
+    }
+    return (double)total / edgeCount;
+}
@@ -0,0 +1,50 @@
+#ifndef ROUTING_SNAPSHOT_H
+#define ROUTING_SNAPSHOT_H
+
+#include <unordered_map>
+#include <vector>
+#include "models/Graph.h"
+
+// How dense indices are assigned. Anything but INSERTION renumbers the
+// nodes so that neighbors sit close together in the CSR arrays.
+enum class NodeOrder {
+    INSERTION,   // Graph slot order
+    BFS,         // Breadth-first from a minimum-degree node of each component
+    RCM,         // Reverse Cuthill-McKee (BFS, neighbors by ascending degree, reversed)
+    HILBERT      // Hilbert curve over node positions; BFS if any node has none
+};
+
+const char* nodeOrderName(NodeOrder order);
+
+// Read-only CSR copy of the graph for bulk traversals. Active nodes get
+// dense indices 0..nodeCount-1; the edges of node i are
+// outTargets[outOffsets[i] .. outOffsets[i + 1]), and the in-edges use the
+// same layout in the reverse arrays. nodeIds is the permutation back to
+// node IDs for whichever order was applied.
+struct RoutingSnapshot {
+    int nodeCount;
+    int edgeCount;
+    unsigned long long graphVersion;       // Graph::getVersion() at build time
+    NodeOrder order;                       // Order actually applied
+    std::vector<int> nodeIds;              // Dense index -> node ID
+    std::unordered_map<int, int> indexById;
+    std::vector<int> outOffsets;           // nodeCount + 1 entries
+    std::vector<int> outTargets;           // Dense indices
+    std::vector<double> outWeights;
+    std::vector<int> inOffsets;
+    std::vector<int> inSources;
+
+    explicit RoutingSnapshot(const Graph& graph, NodeOrder order = NodeOrder::INSERTION);
+
+    int indexOf(int nodeId) const {
+        auto it = indexById.find(nodeId);
+        return it != indexById.end() ? it->second : -1;
+    }
+    bool isCurrent(const Graph& graph) const { return graphVersion == graph.getVersion(); }
+
+    // Locality of the numbering: largest and mean |source - target| over all edges
+    int bandwidth() const;
+    double averageEdgeSpan() const;
+};
+
+#endif
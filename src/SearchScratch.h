@@ -0,0 +1,77 @@
+#ifndef SEARCH_SCRATCH_H
+#define SEARCH_SCRATCH_H
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+// Reusable per-slot buffers for repeated shortest-path searches.
+// Every entry is tagged with the generation that wrote it, so starting a new
+// search is O(1) instead of refilling V-sized arrays.
+struct SearchScratch {
+    typedef std::pair<double, int> QueueEntry;  // (cost, slot)
+
+    std::vector<double> dist;
+    std::vector<int> prev;
+    std::vector<unsigned> reached;   // dist/prev valid when == generation
+    std::vector<unsigned> settled;
+    std::vector<unsigned> blocked;   // Slot excluded from this search
+    std::vector<QueueEntry> heap;
+    unsigned generation;
+
+    SearchScratch() : generation(0) {}
+
+    void reset(int slotCount) {
+        if ((int)dist.size() != slotCount) {
+            dist.assign(slotCount, 0.0);
+            prev.assign(slotCount, -1);
+            reached.assign(slotCount, 0);
+            settled.assign(slotCount, 0);
+            blocked.assign(slotCount, 0);
+            generation = 0;
+        }
+        if (++generation == 0) {  // Wrapped: stale tags could alias, clear them once
+            std::fill(reached.begin(), reached.end(), 0);
+            std::fill(settled.begin(), settled.end(), 0);
+            std::fill(blocked.begin(), blocked.end(), 0);
+            generation = 1;
+        }
+        heap.clear();
+    }
+
+    bool isReached(int slot) const { return reached[slot] == generation; }
+    bool isSettled(int slot) const { return settled[slot] == generation; }
+    bool isBlocked(int slot) const { return blocked[slot] == generation; }
+    void settle(int slot) { settled[slot] = generation; }
+    void block(int slot) { blocked[slot] = generation; }
+
+    double distanceTo(int slot) const {
+        return isReached(slot) ? dist[slot] : std::numeric_limits<double>::infinity();
+    }
+
+    // Returns true if the label improved
+    bool relax(int slot, double cost, int from) {
+        if (isReached(slot) && dist[slot] <= cost) return false;
+        reached[slot] = generation;
+        dist[slot] = cost;
+        prev[slot] = from;
+        push(cost, slot);
+        return true;
+    }
+
+    void push(double cost, int slot) {
+        heap.push_back({cost, slot});
+        std::push_heap(heap.begin(), heap.end(), std::greater<QueueEntry>());
+    }
+
+    QueueEntry pop() {
+        std::pop_heap(heap.begin(), heap.end(), std::greater<QueueEntry>());
+        QueueEntry top = heap.back();
+        heap.pop_back();
+        return top;
+    }
+};
+
+#endif
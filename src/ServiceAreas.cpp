@@ -0,0 +1,104 @@
+#include "Algorithms.h"
+#include "CostPolicies.h"
+#include "SearchScratch.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace {
+    const size_t ORIGINS_PER_CLAIM = 16;  // Work unit taken from the shared counter
+
+    // Bounded search: only the count and the farthest settled cost are kept,
+    // and the frontier is never pushed past the budget.
+    template <typename Cost>
+    ServiceArea boundedArea(const Graph& graph, SearchScratch& scratch, int originSlot, double budget) {
+        const Node* nodes = graph.getNodes();
+        ServiceArea area;
+        area.nodeId = nodes[originSlot].id;
+
+        scratch.reset(graph.getMaxNodes());
+        scratch.relax(originSlot, 0.0, -1);
+        while (!scratch.heap.empty()) {
+            auto [current, u] = scratch.pop();
+            if (scratch.isSettled(u)) continue;
+            scratch.settle(u);
+            area.reachableCount++;
+            area.farthestCost = current;
+
+            for (const Edge* edge = nodes[u].adjacencyList; edge != nullptr; edge = edge->next) {
+                int v = graph.findNodeIndex(edge->destination);
+                if (v == -1 || scratch.isSettled(v)) continue;
+
+                double candidate = current + Cost::cost(*edge);
+                if (candidate <= budget) {
+                    scratch.relax(v, candidate, u);
+                }
+            }
+        }
+        return area;
+    }
+
+    template <typename Cost>
+    void runWorkers(const Graph& graph, const std::vector<int>& origins, double budget, int threadCount,
+                    std::vector<ServiceArea>& areas) {
+        std::atomic<size_t> nextOrigin(0);
+
+        // Each worker owns its scratch and writes only its claimed rows
+        auto worker = [&]() {
+            SearchScratch scratch;
+            while (true) {
+                size_t begin = nextOrigin.fetch_add(ORIGINS_PER_CLAIM);
+                if (begin >= origins.size()) break;
+                size_t end = std::min(begin + ORIGINS_PER_CLAIM, origins.size());
+                for (size_t i = begin; i < end; i++) {
+                    areas[i] = boundedArea<Cost>(graph, scratch, origins[i], budget);
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (int t = 1; t < threadCount; t++) {
+            threads.emplace_back(worker);
+        }
+        worker();
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+}
+
+std::vector<ServiceArea> computeServiceAreas(const Graph& graph, double budget, CostMetric metric, int threadCount) {
+    const Node* nodes = graph.getNodes();
+    std::vector<int> origins;
+    for (int i = 0; i < graph.getMaxNodes(); i++) {
+        if (nodes[i].active) {
+            origins.push_back(i);
+        }
+    }
+
+    std::vector<ServiceArea> areas(origins.size());
+    if (origins.empty()) {
+        return areas;
+    }
+
+    if (threadCount <= 0) {
+        threadCount = (int)std::max(1u, std::thread::hardware_concurrency());
+    }
+    size_t claims = (origins.size() + ORIGINS_PER_CLAIM - 1) / ORIGINS_PER_CLAIM;
+    threadCount = (int)std::min<size_t>(threadCount, claims);
+
+    switch (metric) {
+        case CostMetric::DISTANCE:
+            runWorkers<DistanceCost>(graph, origins, budget, threadCount, areas);
+            break;
+        case CostMetric::TOLL:
+            runWorkers<TollCost>(graph, origins, budget, threadCount, areas);
+            break;
+        case CostMetric::TIME:
+        default:
+            runWorkers<TimeCost>(graph, origins, budget, threadCount, areas);
+            break;
+    }
+    return areas;
+}
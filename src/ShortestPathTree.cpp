@@ -0,0 +1,123 @@
+#include "Algorithms.h"
+#include "CostPolicies.h"
+#include "SearchScratch.h"
+#include "utils/colors.h"
+#include <iostream>
+#include <iomanip>
+#include <limits>
+#include <vector>
+
+namespace {
+    // Settles nodes in cost order and stops once the frontier passes radius.
+    template <typename Cost>
+    void growTree(const Graph& graph, SearchScratch& scratch, int sourceSlot, double radius,
+                  ShortestPathTree& tree) {
+        const Node* nodes = graph.getNodes();
+
+        scratch.relax(sourceSlot, 0.0, -1);
+        while (!scratch.heap.empty()) {
+            auto [current, u] = scratch.pop();
+            if (scratch.isSettled(u)) continue;
+            if (current > radius) break;
+            scratch.settle(u);
+
+            tree.dist[u] = current;
+            tree.prev[u] = scratch.prev[u] == -1 ? -1 : nodes[scratch.prev[u]].id;
+            tree.order.push_back(nodes[u].id);
+
+            for (const Edge* edge = nodes[u].adjacencyList; edge != nullptr; edge = edge->next) {
+                int v = graph.findNodeIndex(edge->destination);
+                if (v == -1 || scratch.isSettled(v)) continue;
+
+                double candidate = current + Cost::cost(*edge);
+                if (candidate <= radius) {
+                    scratch.relax(v, candidate, u);
+                }
+            }
+        }
+    }
+}
+
+ShortestPathTree shortestPathTree(const Graph& graph, int sourceId, CostMetric metric, double radius) {
+    ShortestPathTree tree;
+    tree.sourceId = sourceId;
+    tree.metric = metric;
+    tree.radius = radius;
+
+    int sourceSlot = graph.findNodeIndex(sourceId);
+    int slotCount = graph.getMaxNodes();
+    tree.dist.assign(slotCount, std::numeric_limits<double>::infinity());
+    tree.prev.assign(slotCount, -1);
+    if (sourceSlot == -1) {
+        return tree;
+    }
+
+    SearchScratch scratch;
+    scratch.reset(slotCount);
+
+    switch (metric) {
+        case CostMetric::TIME:
+            growTree<TimeCost>(graph, scratch, sourceSlot, radius, tree);
+            break;
+        case CostMetric::TOLL:
+            growTree<TollCost>(graph, scratch, sourceSlot, radius, tree);
+            break;
+        case CostMetric::DISTANCE:
+        default:
+            growTree<DistanceCost>(graph, scratch, sourceSlot, radius, tree);
+            break;
+    }
+    return tree;
+}
+
+std::vector<int> treePath(const Graph& graph, const ShortestPathTree& tree, int destId) {
+    std::vector<int> path;
+    int slot = graph.findNodeIndex(destId);
+    if (slot == -1 || slot >= (int)tree.dist.size() ||
+        tree.dist[slot] == std::numeric_limits<double>::infinity()) {
+        return path;
+    }
+
+    for (int current = destId; current != -1; ) {
+        path.push_back(current);
+        int index = graph.findNodeIndex(current);
+        if (index == -1) break;
+        current = tree.prev[index];
+    }
+    return std::vector<int>(path.rbegin(), path.rend());
+}
+
+void displayShortestPathTree(const Graph& graph, const ShortestPathTree& tree) {
+    system("cls");
+    std::cout << BOLD << "Shortest path tree from [" << tree.sourceId << "] "
+              << graph.getNodeName(tree.sourceId) << RESET << "\n";
+
+    const char* unit = tree.metric == CostMetric::TIME ? "min" : tree.metric == CostMetric::TOLL ? "toll" : "km";
+    if (tree.radius != std::numeric_limits<double>::infinity()) {
+        std::cout << "Radius: " << std::fixed << std::setprecision(1) << tree.radius << " " << unit << "\n";
+    }
+
+    if (tree.order.empty()) {
+        std::cout << "Source node not found!\n";
+        return;
+    }
+
+    std::cout << CYAN << tree.order.size() << " of " << graph.getNodeCount()
+              << " node(s) reachable\n\n" << RESET;
+
+    std::cout << std::setw(6) << "ID" << " | " << std::setw(20) << "Name" << " | "
+              << std::setw(10) << "Cost" << " | " << "Via" << "\n";
+    std::cout << std::string(55, '-') << "\n";
+
+    for (int id : tree.order) {
+        int slot = graph.findNodeIndex(id);
+        std::cout << std::setw(6) << id << " | " << std::setw(20) << graph.getNodeName(id) << " | "
+                  << std::setw(10) << std::fixed << std::setprecision(2) << tree.dist[slot] << " | ";
+        if (tree.prev[slot] == -1) {
+            std::cout << GRAY << "(source)" << RESET;
+        } else {
+            std::cout << "[" << tree.prev[slot] << "] " << graph.getNodeName(tree.prev[slot]);
+        }
+        std::cout << "\n";
+    }
+}
@@ -0,0 +1,45 @@
+#include "Algorithms.h"
+#include "RoutingSnapshot.h"
+#include "SearchScratch.h"
+#include <algorithm>
+
+// Same search as dijkstra() but over the snapshot's contiguous arrays, so
+// the memory traffic follows the snapshot's node order.
+PathResult snapshotDijkstra(const RoutingSnapshot& snapshot, int sourceId, int destId, SearchScratch& scratch) {
+    PathResult result;
+    int source = snapshot.indexOf(sourceId);
+    int dest = snapshot.indexOf(destId);
+    if (source == -1 || dest == -1) {
+        return result;
+    }
+
+    scratch.reset(snapshot.nodeCount);
+    scratch.relax(source, 0.0, -1);
+
+    while (!scratch.heap.empty()) {
+        auto [cost, node] = scratch.pop();
+        if (scratch.isSettled(node)) continue;
+        scratch.settle(node);
+        if (node == dest) break;
+
+        for (int e = snapshot.outOffsets[node]; e < snapshot.outOffsets[node + 1]; e++) {
+            int target = snapshot.outTargets[e];
+            if (!scratch.isSettled(target)) {
+                scratch.relax(target, cost + snapshot.outWeights[e], node);
+            }
+        }
+    }
+
+    if (!scratch.isSettled(dest)) {
+        return result;
+    }
+
+    result.found = true;
+    result.totalDistance = scratch.dist[dest];
+    result.travelTimeMinutes = result.totalDistance / DEFAULT_SPEED_KMH * 60.0;
+    for (int node = dest; node != -1; node = scratch.prev[node]) {
+        result.path.push_back(snapshot.nodeIds[node]);
+    }
+    std::reverse(result.path.begin(), result.path.end());
+    return result;
+}
@@ -0,0 +1,26 @@
+#include "SnapshotPublisher.h"
+
+SnapshotPublisher::SnapshotPublisher(NodeOrder order) : order(order), publishCount(0) {}
+
+std::shared_ptr<const RoutingSnapshot> SnapshotPublisher::publish(const Graph& graph) {
+    std::lock_guard<std::mutex> lock(publishMutex);
+
+    // Built off to the side; readers keep using the previous version meanwhile
+    std::shared_ptr<const RoutingSnapshot> snapshot = std::make_shared<const RoutingSnapshot>(graph, order);
+    current.store(snapshot, std::memory_order_release);
+    publishCount.fetch_add(1, std::memory_order_relaxed);
+    return snapshot;
+}
+
+std::shared_ptr<const RoutingSnapshot> SnapshotPublisher::publishIfChanged(const Graph& graph) {
+    std::shared_ptr<const RoutingSnapshot> snapshot = acquire();
+    if (snapshot != nullptr && snapshot->isCurrent(graph)) {
+        return snapshot;
+    }
+    return publish(graph);
+}
+
+unsigned long long SnapshotPublisher::getPublishedVersion() const {
+    std::shared_ptr<const RoutingSnapshot> snapshot = acquire();
+    return snapshot != nullptr ? snapshot->graphVersion : 0;
+}
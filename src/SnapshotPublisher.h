@@ -0,0 +1,43 @@
+#ifndef SNAPSHOT_PUBLISHER_H
+#define SNAPSHOT_PUBLISHER_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include "RoutingSnapshot.h"
+
+// RCU-style publication of immutable graph versions. One writer owns the
+// mutable Graph: it applies edits, then publish() builds a RoutingSnapshot
+// of the result and swaps it in with a single atomic store. Query threads
+// call acquire() and hold the returned pointer for the whole query, so they
+// always see one consistent version and never wait for the writer; a
+// retired snapshot is freed when its last reader drops it (the reference
+// count stands in for RCU's grace period).
+//
+// The Graph itself is still single-threaded: only the writer may touch it,
+// readers work on snapshots only.
+class SnapshotPublisher {
+private:
+    std::atomic<std::shared_ptr<const RoutingSnapshot>> current;
+    std::mutex publishMutex;  // Serializes writers; readers never take it
+    NodeOrder order;
+    std::atomic<unsigned long long> publishCount;
+
+public:
+    explicit SnapshotPublisher(NodeOrder order = NodeOrder::INSERTION);
+
+    // Reader side: latest published version, nullptr before the first publish
+    std::shared_ptr<const RoutingSnapshot> acquire() const {
+        return current.load(std::memory_order_acquire);
+    }
+
+    // Writer side: snapshot the graph as it is now and make it current
+    std::shared_ptr<const RoutingSnapshot> publish(const Graph& graph);
+    // Writer side: reuses the current snapshot when the graph has not changed
+    std::shared_ptr<const RoutingSnapshot> publishIfChanged(const Graph& graph);
+
+    unsigned long long getPublishedVersion() const;  // Graph version of the current snapshot, 0 if none
+    unsigned long long getPublishCount() const { return publishCount.load(std::memory_order_relaxed); }
+};
+
+#endif
@@ -0,0 +1,84 @@
+#include "Algorithms.h"
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <queue>
+#include <vector>
+#include <functional>
+
+// Label-setting search on arrival time. Travel time on an edge depends on
+// the time the vehicle enters it; profiles are integrated exactly, which
+// keeps the FIFO property so settled labels are final.
+PathResult timeDependentDijkstra(const Graph& graph, int sourceId, int destId, double departureMinute) {
+    PathResult result;
+    result.timeDependent = true;
+    result.departureMinute = departureMinute;
+
+    int sourceIndex = graph.findNodeIndex(sourceId);
+    int destIndex = graph.findNodeIndex(destId);
+    if (sourceIndex == -1 || destIndex == -1) {
+        return result;
+    }
+
+    const double inf = std::numeric_limits<double>::infinity();
+    int slotCount = graph.getMaxNodes();
+    const Node* nodes = graph.getNodes();
+
+    std::vector<double> arrival(slotCount, inf);
+    std::vector<double> distanceKm(slotCount, 0.0);
+    std::vector<int> prev(slotCount, -1);
+    std::vector<bool> settled(slotCount, false);
+
+    typedef std::pair<double, int> QueueEntry;  // (arrival minute, slot)
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> queue;
+
+    arrival[sourceIndex] = departureMinute;
+    queue.push({departureMinute, sourceIndex});
+
+    while (!queue.empty()) {
+        auto [time, u] = queue.top();
+        queue.pop();
+
+        if (settled[u]) continue;
+        settled[u] = true;
+        if (u == destIndex) break;
+
+        for (Edge* edge = nodes[u].adjacencyList; edge != nullptr; edge = edge->next) {
+            int v = graph.findNodeIndex(edge->destination);
+            if (v == -1 || settled[v]) continue;
+
+            double reach = time + graph.edgeTravelMinutes(*edge, time);
+            if (reach < arrival[v]) {
+                arrival[v] = reach;
+                distanceKm[v] = distanceKm[u] + edge->weight;
+                prev[v] = u;
+                queue.push({reach, v});
+            }
+        }
+    }
+
+    if (arrival[destIndex] == inf) {
+        return result;
+    }
+
+    result.found = true;
+    result.arrivalMinute = arrival[destIndex];
+    result.travelTimeMinutes = arrival[destIndex] - departureMinute;
+    result.totalDistance = distanceKm[destIndex];
+
+    std::vector<int> reversePath;
+    for (int slot = destIndex; slot != -1; slot = prev[slot]) {
+        reversePath.push_back(nodes[slot].id);
+    }
+    result.path.assign(reversePath.rbegin(), reversePath.rend());
+
+    return result;
+}
+
+std::string formatClockTime(double minuteOfDay) {
+    long total = std::lround(minuteOfDay);
+    int minutes = (int)(((total % 1440) + 1440) % 1440);
+    char buffer[8];
+    std::snprintf(buffer, sizeof(buffer), "%02d:%02d", minutes / 60, minutes % 60);
+    return buffer;
+}
@@ -4,8 +4,11 @@
 #include "services/SelectionService.h"
 #include "services/MessageService.h"
 #include "services/FileService.h"
+#include "services/UIService.h"
 #include <fstream>
 #include <iomanip>
+#include <sstream>
+#include <vector>
 #include <conio.h>
 
 NetworkController::NetworkController(Graph& net) : network(net) {}
@@ -104,6 +107,37 @@ void NetworkController::handleRemoveNode() {
     }
 }
 
+void NetworkController::handleRemoveNodes() {
+    messageService.showTitle("Remove multiple nodes");
+
+    auto input = getStringInput("Enter node IDs to remove (comma separated): ");
+    if (!withInput(input, [this](const std::string& list) {
+        std::vector<int> ids;
+        std::stringstream ss(list);
+        std::string token;
+
+        while (std::getline(ss, token, ',')) {
+            token = trimString(token);
+            if (token.empty()) continue;
+            try {
+                ids.push_back(std::stoi(token));
+            } catch (...) {
+                messageService.showError("Invalid node ID: " + token);
+                return;
+            }
+        }
+
+        if (ids.empty()) {
+            messageService.showError("No node IDs given!");
+            return;
+        }
+
+        network.removeNodes(ids);
+    })) {
+        messageService.showCancelled();
+    }
+}
+
 void NetworkController::handleRemoveEdge() {
     messageService.showTitle("Remove edge");
 
@@ -146,6 +180,142 @@ void NetworkController::handleRemoveEdge() {
     }
 }
 
+void NetworkController::handleUpdateEdgeWeight() {
+    messageService.showTitle("Update edge weight");
+
+    if (network.getNodeCount() == 0) {
+        messageService.showError("No nodes in network!");
+        return;
+    }
+
+    auto nodePair = selectionService.selectNodePair(network, "SELECT SOURCE NODE", "SELECT DESTINATION NODE", true);
+    if (nodePair.cancelled) {
+        messageService.showCancelled();
+        return;
+    }
+
+    system("cls");
+    messageService.showTitle("Update edge weight");
+
+    if (!network.hasEdge(nodePair.sourceId, nodePair.destId)) {
+        messageService.showError("Edge not found!");
+        return;
+    }
+
+    std::cout << network.getNodeName(nodePair.sourceId) << " -> "
+              << network.getNodeName(nodePair.destId) << " (current weight: "
+              << network.getEdgeWeight(nodePair.sourceId, nodePair.destId) << ")\n";
+
+    auto weight = getDoubleInput("Enter new weight (distance/time): ");
+    if (!withInput(weight, [&](double w) {
+        network.updateEdgeWeight(nodePair.sourceId, nodePair.destId, w);
+    })) {
+        messageService.showCancelled();
+    }
+}
+
+void NetworkController::handleApplyWeightUpdates() {
+    messageService.showTitle("Apply weight updates");
+
+    if (network.getNodeCount() == 0) {
+        messageService.showError("No nodes in network!");
+        return;
+    }
+
+    auto filename = getStringInput("Enter updates filename (without extension): ");
+    if (!withInput(filename, [this](const std::string& name) {
+        fileService.applyWeightUpdates(name, network);
+    })) {
+        messageService.showCancelled();
+    }
+}
+
+void NetworkController::handleSetEdgeAttributes() {
+    messageService.showTitle("Set edge attributes");
+
+    if (network.getNodeCount() == 0) {
+        messageService.showError("No nodes in network!");
+        return;
+    }
+
+    auto nodePair = selectionService.selectNodePair(network, "SELECT SOURCE NODE", "SELECT DESTINATION NODE", true);
+    if (nodePair.cancelled) {
+        messageService.showCancelled();
+        return;
+    }
+
+    system("cls");
+    messageService.showTitle("Set edge attributes");
+
+    if (!network.hasEdge(nodePair.sourceId, nodePair.destId)) {
+        messageService.showError("Edge not found!");
+        return;
+    }
+
+    std::cout << network.getNodeName(nodePair.sourceId) << " -> "
+              << network.getNodeName(nodePair.destId) << "\n\n";
+
+    auto minutes = getDoubleInput("Free-flow time in minutes (0 = from distance): ", false);
+    if (!minutes.has_value()) {
+        messageService.showCancelled();
+        return;
+    }
+
+    auto toll = getDoubleInput("Toll (0 = free): ", false);
+    if (!toll.has_value()) {
+        messageService.showCancelled();
+        return;
+    }
+
+    auto classes = getStringInput("Restricted classes (e.g. Truck|Sedan, - for none): ");
+    if (!classes.has_value()) {
+        messageService.showCancelled();
+        return;
+    }
+
+    unsigned char restrictions = classes.value() == "-" ? VEHICLE_CLASS_NONE
+                                                         : vehicleClassesFromString(classes.value());
+
+    if (network.setEdgeAttributes(nodePair.sourceId, nodePair.destId, minutes.value(), toll.value(), restrictions)) {
+        messageService.showSuccess("Edge attributes updated!");
+    }
+}
+
+void NetworkController::handleSetNodePosition() {
+    messageService.showTitle("Set node position");
+
+    if (network.getNodeCount() == 0) {
+        messageService.showError("No nodes in network!");
+        return;
+    }
+
+    int nodeId = selectionService.selectNode(network, "SELECT NODE");
+    if (nodeId == -1) {
+        messageService.showCancelled();
+        return;
+    }
+
+    system("cls");
+    messageService.showTitle("Set node position");
+    std::cout << network.getNodeName(nodeId) << "\n\n";
+
+    auto x = getDoubleInput("X coordinate: ", false);
+    if (!x.has_value()) {
+        messageService.showCancelled();
+        return;
+    }
+
+    auto y = getDoubleInput("Y coordinate: ", false);
+    if (!y.has_value()) {
+        messageService.showCancelled();
+        return;
+    }
+
+    if (network.setNodePosition(nodeId, x.value(), y.value())) {
+        messageService.showSuccess("Node position updated!");
+    }
+}
+
 void NetworkController::handleGenerateSeed() {
     messageService.showTitle("Generate seed file");
 
@@ -156,3 +326,58 @@ void NetworkController::handleGenerateSeed() {
         messageService.showCancelled();
     }
 }
+
+void NetworkController::handleGenerateSyntheticNetwork() {
+    messageService.showTitle("Generate synthetic network");
+
+    UIService uiService;
+    int shape = uiService.showSelector("Network shape", {"Grid", "Random geometric", "Scale-free"});
+    if (shape == -1) {
+        messageService.showCancelled();
+        return;
+    }
+
+    system("cls");
+    messageService.showTitle("Generate synthetic network");
+
+    NetworkSpec spec;
+    spec.shape = static_cast<NetworkShape>(shape);
+
+    auto nodeCount = getIntInput("Number of nodes: ");
+    if (!nodeCount.has_value()) {
+        messageService.showCancelled();
+        return;
+    }
+    if (nodeCount.value() < 2) {
+        messageService.showError("A network needs at least 2 nodes!");
+        return;
+    }
+    spec.nodeCount = nodeCount.value();
+
+    if (spec.shape != NetworkShape::GRID) {
+        auto degree = getIntInput("Average links per node (2-16): ");
+        if (!degree.has_value()) {
+            messageService.showCancelled();
+            return;
+        }
+        if (degree.value() < 2 || degree.value() > 16) {
+            messageService.showError("Average links must be between 2 and 16!");
+            return;
+        }
+        spec.averageDegree = degree.value();
+    }
+
+    auto seed = getIntInput("Random seed: ");
+    if (!seed.has_value()) {
+        messageService.showCancelled();
+        return;
+    }
+    spec.seed = (unsigned)seed.value();
+
+    auto filename = getStringInput("Enter filename (without extension): ");
+    if (!withInput(filename, [&spec](const std::string& name) {
+        fileService.generateSyntheticNetwork(name, spec);
+    })) {
+        messageService.showCancelled();
+    }
+}
@@ -17,8 +17,14 @@ public:
     void handleAddNode();
     void handleAddEdge();
     void handleRemoveNode();
+    void handleRemoveNodes();
     void handleRemoveEdge();
+    void handleUpdateEdgeWeight();
+    void handleApplyWeightUpdates();
+    void handleSetEdgeAttributes();
+    void handleSetNodePosition();
     void handleGenerateSeed();
+    void handleGenerateSyntheticNetwork();
 };
 
 #endif
@@ -6,6 +6,7 @@
 #include "services/FileService.h"
 #include "Algorithms.h"
 #include <conio.h>
+#include <iomanip>
 
 VehicleController::VehicleController(HashTable& reg, Graph& net)
     : registry(reg), network(net) {}
@@ -76,14 +77,14 @@ void VehicleController::handleSearchVehicle() {
 
     auto id = getIntInput("Enter vehicle ID to search: ");
     if (!withInput(id, [this](int vehicleId) {
-        Vehicle* vehicle = registry.searchVehicle(vehicleId);
-        if (vehicle != nullptr) {
+        Vehicle vehicle;
+        if (registry.getVehicle(vehicleId, vehicle)) {
             std::cout << "\nVehicle found!\n";
-            std::cout << "ID: " << vehicle->id << "\n";
-            std::cout << "Plate: " << vehicle->plate << "\n";
-            std::cout << "Type: " << vehicle->type << "\n";
-            std::cout << "Current Node: " << vehicle->currentNodeId << "\n";
-            std::cout << "Destination Node: " << vehicle->destinationNodeId << "\n";
+            std::cout << "ID: " << vehicle.id << "\n";
+            std::cout << "Plate: " << vehicle.plate << "\n";
+            std::cout << "Type: " << vehicle.type << "\n";
+            std::cout << "Current Node: " << vehicle.currentNodeId << "\n";
+            std::cout << "Destination Node: " << vehicle.destinationNodeId << "\n";
         } else {
             messageService.showError("Vehicle not found!");
         }
@@ -130,8 +131,9 @@ void VehicleController::handleMoveVehicle() {
         return;
     }
 
-    Vehicle* vehicle = registry.searchVehicle(vehicleId);
-    if (vehicle == nullptr) {
+    VehicleHandle handle = registry.searchVehicle(vehicleId);
+    Vehicle vehicle;
+    if (!handle.read(vehicle)) {
         messageService.showError("Vehicle not found!");
         return;
     }
@@ -142,17 +144,30 @@ void VehicleController::handleMoveVehicle() {
         return;
     }
 
-    if (vehicle->currentNodeId == destId) {
+    if (vehicle.currentNodeId == destId) {
         system("cls");
         messageService.showError("Vehicle is already at destination!");
         return;
     }
 
-    PathResult result = dijkstra(network, vehicle->currentNodeId, destId, true);
+    components.refresh(network);
+    if (components.reachability(vehicle.currentNodeId, destId) == Reachability::UNREACHABLE) {
+        registry.logMovement(vehicleId, destId, "failed", 0.0, "Destination unreachable");
+        system("cls");
+        messageService.showError("Destination is unreachable from the vehicle's location!");
+        std::cout << "(one-way roads do not connect these parts of the network)\n";
+        return;
+    }
+
+    // Class-aware route so trucks etc. never use roads restricted for them
+    PathResult result = routeCache.route(network, vehicle.currentNodeId, destId, CostMetric::DISTANCE, vehicle.type);
+
+    if (result.found && !handle.moveTo(destId, destId)) {
+        messageService.showError("Vehicle was removed while routing!");
+        return;
+    }
 
     if (result.found) {
-        vehicle->currentNodeId = destId;
-        vehicle->destinationNodeId = destId;
         registry.logMovement(vehicleId, destId, "success", result.travelTimeMinutes, "");
 
         displayPath(network, result);
@@ -168,3 +183,119 @@ void VehicleController::handleMoveVehicle() {
 void VehicleController::handleShowMovementHistory() {
     registry.showMovementHistory();
 }
+
+void VehicleController::handleGenerateSyntheticFleet() {
+    messageService.showTitle("Generate synthetic fleet");
+
+    auto vehicleCount = getIntInput("Number of vehicles: ");
+    if (!vehicleCount.has_value()) {
+        messageService.showCancelled();
+        return;
+    }
+    if (vehicleCount.value() < 1) {
+        messageService.showError("Fleet needs at least one vehicle!");
+        return;
+    }
+
+    // Synthetic networks number their nodes 0..N-1
+    auto nodeCount = getIntInput("Place vehicles on node IDs 0..N-1, N: ");
+    if (!nodeCount.has_value()) {
+        messageService.showCancelled();
+        return;
+    }
+    if (nodeCount.value() < 1) {
+        messageService.showError("N must be at least 1!");
+        return;
+    }
+
+    auto seed = getIntInput("Random seed: ");
+    if (!seed.has_value()) {
+        messageService.showCancelled();
+        return;
+    }
+
+    auto filename = getStringInput("Enter filename (without extension): ");
+    if (!withInput(filename, [&](const std::string& name) {
+        fileService.generateSyntheticFleet(name, vehicleCount.value(), nodeCount.value(), (unsigned)seed.value());
+    })) {
+        messageService.showCancelled();
+    }
+}
+
+void VehicleController::handleShowRouteCacheStats() {
+    messageService.showTitle("Route cache");
+
+    unsigned long long lookups = routeCache.getHits() + routeCache.getMisses();
+    std::cout << "Cached routes:    " << routeCache.getSize() << " / " << routeCache.getCapacity() << "\n";
+    std::cout << "Lookups:          " << lookups << "\n";
+    std::cout << "Hits:             " << routeCache.getHits() << "\n";
+    std::cout << "Misses:           " << routeCache.getMisses() << "\n";
+    std::cout << "Hit rate:         " << std::fixed << std::setprecision(1)
+              << routeCache.getHitRate() * 100.0 << "%\n";
+    std::cout << "Evictions:        " << routeCache.getEvictions() << "\n";
+    std::cout << "Flushed by edits: " << routeCache.getInvalidations() << "\n";
+}
+
+void VehicleController::handleIngestTelemetry() {
+    messageService.showTitle("Ingest telemetry");
+
+    if (registry.getVehicleCount() == 0) {
+        messageService.showError("No vehicles registered! Load a fleet first.");
+        return;
+    }
+    if (network.getNodeCount() == 0) {
+        messageService.showError("No network loaded! Load a network first.");
+        return;
+    }
+
+    auto filename = getStringInput("Enter filename or pipe name in data/ (without extension): ");
+    if (!withInput(filename, [this](const std::string& name) {
+        fileService.ingestTelemetry(name, registry, network);
+    })) {
+        messageService.showCancelled();
+    }
+}
+
+void VehicleController::handleGenerateTelemetry() {
+    messageService.showTitle("Generate telemetry replay");
+
+    auto updateCount = getIntInput("Number of position fixes: ");
+    if (!updateCount.has_value()) {
+        messageService.showCancelled();
+        return;
+    }
+    if (updateCount.value() < 1) {
+        messageService.showError("Replay needs at least one fix!");
+        return;
+    }
+
+    // Matches the IDs of a synthetic fleet and network
+    auto vehicleCount = getIntInput("Report vehicle IDs 0..V-1, V: ");
+    if (!vehicleCount.has_value()) {
+        messageService.showCancelled();
+        return;
+    }
+    auto nodeCount = getIntInput("Report node IDs 0..N-1, N: ");
+    if (!nodeCount.has_value()) {
+        messageService.showCancelled();
+        return;
+    }
+    if (vehicleCount.value() < 1 || nodeCount.value() < 1) {
+        messageService.showError("V and N must be at least 1!");
+        return;
+    }
+
+    auto seed = getIntInput("Random seed: ");
+    if (!seed.has_value()) {
+        messageService.showCancelled();
+        return;
+    }
+
+    auto filename = getStringInput("Enter filename (without extension): ");
+    if (!withInput(filename, [&](const std::string& name) {
+        fileService.generateTelemetryReplay(name, updateCount.value(), vehicleCount.value(), nodeCount.value(),
+                                            (unsigned)seed.value());
+    })) {
+        messageService.showCancelled();
+    }
+}
@@ -4,12 +4,16 @@
 #include "BaseController.h"
 #include "models/HashTable.h"
 #include "models/Graph.h"
+#include "ComponentIndex.h"
+#include "RouteCache.h"
 #include <string>
 
 class VehicleController : public BaseController {
 private:
     HashTable& registry;
     Graph& network;
+    ComponentIndex components;  // Rejects impossible moves before any search
+    RouteCache routeCache;      // Repeated moves between the same nodes skip the search
 
 public:
     VehicleController(HashTable& reg, Graph& net);
@@ -23,6 +27,10 @@ public:
     void handleShowHashInfo();
     void handleMoveVehicle();
     void handleShowMovementHistory();
+    void handleGenerateSyntheticFleet();
+    void handleShowRouteCacheStats();
+    void handleIngestTelemetry();
+    void handleGenerateTelemetry();
 };
 
 #endif
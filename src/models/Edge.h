@@ -4,9 +4,15 @@
 struct Edge {
     int destination;
     double weight;
+    int profileId;  // Speed profile, -1 = constant DEFAULT_SPEED_KMH
+    double freeFlowMinutes;      // 0 = derive from weight at DEFAULT_SPEED_KMH
+    double toll;
+    unsigned char restrictions;  // VEHICLE_CLASS_* flags that may not use this edge
     Edge* next;
 
-    Edge(int dest, double w) : destination(dest), weight(w), next(nullptr) {}
+    Edge(int dest, double w)
+        : destination(dest), weight(w), profileId(-1), freeFlowMinutes(0.0), toll(0.0),
+          restrictions(0), next(nullptr) {}
 };
 
 #endif
@@ -0,0 +1,54 @@
+#include "EdgePool.h"
+#include <new>
+#include <cstddef>
+
+EdgePool::EdgePool() : freeList(nullptr), slabUsed(SLAB_SIZE), liveCount(0) {}
+
+EdgePool::~EdgePool() {
+    for (Edge* slab : slabs) {
+        ::operator delete(slab);
+    }
+}
+
+void EdgePool::addSlab() {
+    slabs.push_back(static_cast<Edge*>(::operator new(sizeof(Edge) * SLAB_SIZE)));
+    slabUsed = 0;
+}
+
+Edge* EdgePool::allocate(int destination, double weight) {
+    Edge* slot;
+
+    if (freeList != nullptr) {
+        slot = freeList;
+        freeList = freeList->next;
+    } else {
+        if (slabUsed == SLAB_SIZE) {
+            addSlab();
+        }
+        slot = slabs.back() + slabUsed;
+        slabUsed++;
+    }
+
+    liveCount++;
+    return new (slot) Edge(destination, weight);
+}
+
+void EdgePool::release(Edge* edge) {
+    // Edge is trivially destructible, the storage is simply recycled
+    edge->next = freeList;
+    freeList = edge;
+    liveCount--;
+}
+
+void EdgePool::releaseAll() {
+    for (std::size_t i = 1; i < slabs.size(); i++) {
+        ::operator delete(slabs[i]);
+    }
+    if (slabs.size() > 1) {
+        slabs.erase(slabs.begin() + 1, slabs.end());
+    }
+
+    freeList = nullptr;
+    slabUsed = slabs.empty() ? SLAB_SIZE : 0;
+    liveCount = 0;
+}
@@ -0,0 +1,35 @@
+#ifndef EDGEPOOL_H
+#define EDGEPOOL_H
+
+#include <vector>
+#include "Edge.h"
+
+// Slab allocator for Edge objects owned by a Graph.
+// Released edges go to a free list and are reused before a new slab is carved.
+class EdgePool {
+private:
+    static const int SLAB_SIZE = 4096;  // Edges per slab
+
+    std::vector<Edge*> slabs;
+    Edge* freeList;
+    int slabUsed;   // Edges handed out from the newest slab
+    int liveCount;
+
+    void addSlab();
+
+public:
+    EdgePool();
+    ~EdgePool();
+
+    EdgePool(const EdgePool&) = delete;
+    EdgePool& operator=(const EdgePool&) = delete;
+
+    Edge* allocate(int destination, double weight);
+    void release(Edge* edge);
+    void releaseAll();  // Drops every edge at once, keeps the first slab for reuse
+
+    int getLiveCount() const { return liveCount; }
+    int getCapacity() const { return (int)slabs.size() * SLAB_SIZE; }
+};
+
+#endif
@@ -1,58 +1,201 @@
 #include "Graph.h"
 #include "utils/colors.h"
 #include "views/NetworkView.h"
+#include "Metrics.h"
 #include <iomanip>
 #include <sstream>
 
-Graph::Graph() : nodeCount(0), nextId(0), currentFile("") {
-    for (int i = 0; i < MAX_NODES; i++) {
-        nodes[i].active = false;
+namespace {
+    std::string trimLine(const std::string& text) {
+        size_t end = text.find_last_not_of(" \t\r\n");
+        return end == std::string::npos ? "" : text.substr(0, end + 1);
     }
 }
 
+Graph::Graph() : nodeCount(0), nextId(0), version(0), topologyVersion(0), currentFile(""), journalStart(0) {}
+
 Graph::~Graph() {
-    for (int i = 0; i < MAX_NODES; i++) {
-        if (nodes[i].active) {
-            clearEdges(i);
-        }
+    // Edge storage is released in bulk by the pool
+}
+
+int Graph::acquireSlot() {
+    if (!freeSlots.empty()) {
+        int slot = freeSlots.top();
+        freeSlots.pop();
+        return slot;
     }
+    nodes.emplace_back();
+    return (int)nodes.size() - 1;
 }
 
 int Graph::findNodeIndex(int id) const {
-    for (int i = 0; i < MAX_NODES; i++) {
-        if (nodes[i].active && nodes[i].id == id) {
-            return i;
-        }
-    }
-    return -1;
+    auto it = indexById.find(id);
+    return it != indexById.end() ? it->second : -1;
 }
 
 int Graph::getConnectionCount(int nodeId) const {
+    return getOutDegree(nodeId);
+}
+
+int Graph::getOutDegree(int nodeId) const {
     int index = findNodeIndex(nodeId);
-    if (index == -1) return 0;
+    return index == -1 ? 0 : nodes[index].outDegree;
+}
+
+int Graph::getInDegree(int nodeId) const {
+    int index = findNodeIndex(nodeId);
+    return index == -1 ? 0 : nodes[index].inDegree;
+}
 
-    int count = 0;
-    Edge* edge = nodes[index].adjacencyList;
-    while (edge != nullptr) {
-        count++;
-        edge = edge->next;
+std::map<int, int> Graph::getDegreeHistogram(bool incoming) const {
+    std::map<int, int> histogram;
+    for (int i = 0; i < (int)nodes.size(); i++) {
+        if (nodes[i].active) {
+            histogram[incoming ? nodes[i].inDegree : nodes[i].outDegree]++;
+        }
     }
-    return count;
+    return histogram;
 }
 
-void Graph::clearEdges(int nodeIndex) {
-    Edge* current = nodes[nodeIndex].adjacencyList;
+void Graph::freeEdgeList(Edge*& head) {
+    Edge* current = head;
     while (current != nullptr) {
         Edge* temp = current;
         current = current->next;
-        delete temp;
+        edgePool.release(temp);
+    }
+    head = nullptr;
+}
+
+void Graph::unlinkEdge(Edge*& head, Edge* target) {
+    Edge* current = head;
+    Edge* prev = nullptr;
+    while (current != nullptr && current != target) {
+        prev = current;
+        current = current->next;
+    }
+    if (current == nullptr) return;
+
+    if (prev == nullptr) {
+        head = current->next;
+    } else {
+        prev->next = current->next;
+    }
+    edgePool.release(current);
+}
+
+void Graph::clearEdges(int nodeIndex) {
+    for (Edge* edge = nodes[nodeIndex].adjacencyList; edge != nullptr; edge = edge->next) {
+        edgeIndex.erase(edgeKey(nodes[nodeIndex].id, edge->destination));
+    }
+    freeEdgeList(nodes[nodeIndex].adjacencyList);
+    freeEdgeList(nodes[nodeIndex].incomingList);
+    nodes[nodeIndex].outDegree = 0;
+    nodes[nodeIndex].inDegree = 0;
+}
+
+// Removes every edge in the list whose endpoint lives in a removed slot.
+// ownerId is given for outgoing lists so the edge index stays in sync.
+int Graph::unlinkEdges(Edge*& head, const std::vector<char>& removedSlots, int ownerId) {
+    int removed = 0;
+    Edge* current = head;
+    Edge* prev = nullptr;
+
+    while (current != nullptr) {
+        int slot = findNodeIndex(current->destination);
+        if (slot != -1 && removedSlots[slot]) {
+            if (prev == nullptr) {
+                head = current->next;
+            } else {
+                prev->next = current->next;
+            }
+            if (ownerId != -1) {
+                edgeIndex.erase(edgeKey(ownerId, current->destination));
+            }
+            Edge* temp = current;
+            current = current->next;
+            edgePool.release(temp);
+            removed++;
+        } else {
+            prev = current;
+            current = current->next;
+        }
     }
-    nodes[nodeIndex].adjacencyList = nullptr;
+    return removed;
+}
+
+void Graph::detachNodes(const std::vector<int>& indices) {
+    std::vector<char> removedSlots(nodes.size(), 0);
+    std::vector<char> touched(nodes.size(), 0);
+    for (int index : indices) {
+        removedSlots[index] = 1;
+    }
+
+    // Only in-neighbors and out-neighbors of the removed nodes are visited,
+    // each surviving neighbor list is walked once per batch
+    for (int index : indices) {
+        for (Edge* in = nodes[index].incomingList; in != nullptr; in = in->next) {
+            int sourceIndex = findNodeIndex(in->destination);
+            if (sourceIndex == -1 || removedSlots[sourceIndex] || (touched[sourceIndex] & 1)) continue;
+            touched[sourceIndex] |= 1;
+            nodes[sourceIndex].outDegree -= unlinkEdges(nodes[sourceIndex].adjacencyList, removedSlots,
+                                                       nodes[sourceIndex].id);
+        }
+        for (Edge* out = nodes[index].adjacencyList; out != nullptr; out = out->next) {
+            int destIndex = findNodeIndex(out->destination);
+            if (destIndex == -1 || removedSlots[destIndex] || (touched[destIndex] & 2)) continue;
+            touched[destIndex] |= 2;
+            nodes[destIndex].inDegree -= unlinkEdges(nodes[destIndex].incomingList, removedSlots);
+        }
+    }
+
+    for (int index : indices) {
+        clearEdges(index);
+        nodes[index].active = false;
+        indexById.erase(nodes[index].id);
+        freeSlots.push(index);
+        nodeCount--;
+    }
+    version++;
+    topologyVersion++;
+    resetEdgeJournal();
+}
+
+void Graph::recordEdgeChange(int sourceId, int destId) {
+    if (edgeJournal.size() >= EDGE_JOURNAL_LIMIT) {
+        // Drop the older half; consumers that far behind rebuild instead
+        size_t dropped = EDGE_JOURNAL_LIMIT / 2;
+        journalStart = edgeJournal[dropped - 1].version;
+        edgeJournal.erase(edgeJournal.begin(), edgeJournal.begin() + dropped);
+    }
+    edgeJournal.push_back({version, sourceId, destId});
+}
+
+void Graph::resetEdgeJournal() {
+    edgeJournal.clear();
+    journalStart = version;
+}
+
+bool Graph::getEdgeChangesSince(unsigned long long sinceVersion, std::vector<std::pair<int, int>>& changes) const {
+    changes.clear();
+    if (sinceVersion < journalStart) {
+        return false;
+    }
+
+    // Entries are in version order; walk back to the first one after sinceVersion
+    size_t first = edgeJournal.size();
+    while (first > 0 && edgeJournal[first - 1].version > sinceVersion) {
+        first--;
+    }
+    for (size_t i = first; i < edgeJournal.size(); i++) {
+        changes.push_back({edgeJournal[i].sourceId, edgeJournal[i].destId});
+    }
+    return true;
 }
 
 void Graph::updateNextId() {
     int maxId = -1;
-    for (int i = 0; i < MAX_NODES; i++) {
+    for (int i = 0; i < (int)nodes.size(); i++) {
         if (nodes[i].active && nodes[i].id > maxId) {
             maxId = nodes[i].id;
         }
@@ -60,42 +203,80 @@ void Graph::updateNextId() {
     nextId = maxId + 1;
 }
 
-void Graph::autoSave() {
-    if (!currentFile.empty()) {
-        std::ofstream file(currentFile);
-        if (!file.is_open()) {
-            return;
+void Graph::writeNetwork(std::ostream& out) const {
+    out << "# NODES\n";
+    for (int i = 0; i < (int)nodes.size(); i++) {
+        if (nodes[i].active) {
+            out << "N;" << nodes[i].id << ";" << nodes[i].name << "\n";
         }
+    }
 
-        file << "# NODES\n";
-        for (int i = 0; i < MAX_NODES; i++) {
-            if (nodes[i].active) {
-                file << "N;" << nodes[i].id << ";" << nodes[i].name << "\n";
+    bool positionsWritten = false;
+    for (int i = 0; i < (int)nodes.size(); i++) {
+        if (nodes[i].active && nodes[i].hasPosition) {
+            if (!positionsWritten) {
+                out << "\n# COORDINATES (id;x;y)\n";
+                positionsWritten = true;
             }
+            out << "C;" << nodes[i].id << ";" << nodes[i].x << ";" << nodes[i].y << "\n";
         }
+    }
 
-        file << "\n# EDGES\n";
-        for (int i = 0; i < MAX_NODES; i++) {
-            if (nodes[i].active) {
-                Edge* current = nodes[i].adjacencyList;
-                while (current != nullptr) {
-                    file << "E;" << nodes[i].id << ";" << current->destination
-                         << ";" << current->weight << "\n";
-                    current = current->next;
+    if (!speedProfiles.empty()) {
+        out << "\n# SPEED PROFILES (id;minute:kmh,...)\n";
+        for (const auto& [id, profile] : speedProfiles) {
+            out << "P;" << id << ";" << profile.toString() << "\n";
+        }
+    }
+
+    out << "\n# EDGES\n";
+    for (int i = 0; i < (int)nodes.size(); i++) {
+        if (nodes[i].active) {
+            Edge* current = nodes[i].adjacencyList;
+            while (current != nullptr) {
+                out << "E;" << nodes[i].id << ";" << current->destination
+                    << ";" << current->weight;
+                if (current->profileId != -1) {
+                    out << ";" << current->profileId;
                 }
+                out << "\n";
+                current = current->next;
             }
         }
+    }
 
-        file.close();
+    // Attributes only for edges that differ from the defaults
+    bool headerWritten = false;
+    for (int i = 0; i < (int)nodes.size(); i++) {
+        if (!nodes[i].active) continue;
+        for (Edge* current = nodes[i].adjacencyList; current != nullptr; current = current->next) {
+            if (current->freeFlowMinutes == 0.0 && current->toll == 0.0 && current->restrictions == 0) {
+                continue;
+            }
+            if (!headerWritten) {
+                out << "\n# EDGE ATTRIBUTES (source;destination;freeFlowMinutes;toll;restrictedClasses)\n";
+                headerWritten = true;
+            }
+            out << "A;" << nodes[i].id << ";" << current->destination << ";"
+                << current->freeFlowMinutes << ";" << current->toll << ";"
+                << vehicleClassesToString(current->restrictions) << "\n";
+        }
     }
 }
 
-bool Graph::addNode(int id, const std::string& name) {
-    if (nodeCount >= MAX_NODES) {
-        std::cout << "Error: Maximum node capacity reached!\n";
-        return false;
+void Graph::autoSave() {
+    if (!currentFile.empty()) {
+        std::ofstream file(currentFile);
+        if (!file.is_open()) {
+            return;
+        }
+
+        writeNetwork(file);
+        file.close();
     }
+}
 
+bool Graph::addNode(int id, const std::string& name, bool verbose) {
     if (findNodeIndex(id) != -1) {
         std::cout << "Error: Node with ID " << id << " already exists!\n";
         return false;
@@ -107,33 +288,32 @@ bool Graph::addNode(int id, const std::string& name) {
         return false;
     }
 
-    for (int i = 0; i < MAX_NODES; i++) {
-        if (!nodes[i].active) {
-            nodes[i].id = id;
-            nodes[i].name = name;
-            nodes[i].adjacencyList = nullptr;
-            nodes[i].active = true;
-            nodeCount++;
-
-            // Update nextId if this ID is >= current nextId
-            if (id >= nextId) {
-                nextId = id + 1;
-            }
-
-            std::cout << "Node added successfully: [" << id << "] " << name << "\n";
-            return true;
-        }
+    int i = acquireSlot();
+    nodes[i].id = id;
+    nodes[i].name = name;
+    nodes[i].adjacencyList = nullptr;
+    nodes[i].incomingList = nullptr;
+    nodes[i].outDegree = 0;
+    nodes[i].inDegree = 0;
+    nodes[i].hasPosition = false;
+    nodes[i].active = true;
+    indexById[id] = i;
+    nodeCount++;
+    version++;
+    topologyVersion++;
+
+    // Update nextId if this ID is >= current nextId
+    if (id >= nextId) {
+        nextId = id + 1;
     }
 
-    return false;
+    if (verbose) {
+        std::cout << "Node added successfully: [" << id << "] " << name << "\n";
+    }
+    return true;
 }
 
 bool Graph::addNodeAuto(const std::string& name) {
-    if (nodeCount >= MAX_NODES) {
-        std::cout << "Error: Maximum node capacity reached!\n";
-        return false;
-    }
-
     // Validate name is not empty
     if (name.empty()) {
         std::cout << "Error: Node name cannot be empty!\n";
@@ -142,22 +322,24 @@ bool Graph::addNodeAuto(const std::string& name) {
 
     int id = nextId;
 
-    for (int i = 0; i < MAX_NODES; i++) {
-        if (!nodes[i].active) {
-            nodes[i].id = id;
-            nodes[i].name = name;
-            nodes[i].adjacencyList = nullptr;
-            nodes[i].active = true;
-            nodeCount++;
-            nextId++;
-
-            std::cout << "Node added successfully: [" << id << "] " << name << "\n";
-            autoSave();
-            return true;
-        }
-    }
-
-    return false;
+    int i = acquireSlot();
+    nodes[i].id = id;
+    nodes[i].name = name;
+    nodes[i].adjacencyList = nullptr;
+    nodes[i].incomingList = nullptr;
+    nodes[i].outDegree = 0;
+    nodes[i].inDegree = 0;
+    nodes[i].hasPosition = false;
+    nodes[i].active = true;
+    indexById[id] = i;
+    nodeCount++;
+    version++;
+    topologyVersion++;
+    nextId++;
+
+    std::cout << "Node added successfully: [" << id << "] " << name << "\n";
+    autoSave();
+    return true;
 }
 
 bool Graph::removeNode(int id) {
@@ -167,41 +349,41 @@ bool Graph::removeNode(int id) {
         return false;
     }
 
-    // Remove all edges pointing to this node
-    for (int i = 0; i < MAX_NODES; i++) {
-        if (nodes[i].active && i != index) {
-            Edge* current = nodes[i].adjacencyList;
-            Edge* prev = nullptr;
+    detachNodes({index});
 
-            while (current != nullptr) {
-                if (current->destination == id) {
-                    if (prev == nullptr) {
-                        nodes[i].adjacencyList = current->next;
-                    } else {
-                        prev->next = current->next;
-                    }
-                    Edge* temp = current;
-                    current = current->next;
-                    delete temp;
-                } else {
-                    prev = current;
-                    current = current->next;
-                }
-            }
+    std::cout << "Node removed successfully: [" << id << "]\n";
+    autoSave();
+    return true;
+}
+
+int Graph::removeNodes(const std::vector<int>& ids) {
+    std::vector<int> indices;
+    std::vector<char> seen(nodes.size(), 0);
+
+    for (int id : ids) {
+        int index = findNodeIndex(id);
+        if (index == -1) {
+            std::cout << "Error: Node with ID " << id << " not found!\n";
+            continue;
+        }
+        if (!seen[index]) {
+            seen[index] = 1;
+            indices.push_back(index);
         }
     }
 
-    // Remove edges from this node
-    clearEdges(index);
+    if (indices.empty()) {
+        return 0;
+    }
 
-    nodes[index].active = false;
-    nodeCount--;
-    std::cout << "Node removed successfully: [" << id << "]\n";
+    detachNodes(indices);
+
+    std::cout << "Nodes removed successfully: " << indices.size() << "\n";
     autoSave();
-    return true;
+    return (int)indices.size();
 }
 
-bool Graph::addEdge(int sourceId, int destId, double weight) {
+bool Graph::addEdge(int sourceId, int destId, double weight, bool verbose) {
     int sourceIndex = findNodeIndex(sourceId);
     int destIndex = findNodeIndex(destId);
 
@@ -221,22 +403,31 @@ bool Graph::addEdge(int sourceId, int destId, double weight) {
     }
 
     // Check if edge already exists
-    Edge* current = nodes[sourceIndex].adjacencyList;
-    while (current != nullptr) {
-        if (current->destination == destId) {
-            std::cout << "Error: Edge already exists! Use update instead.\n";
-            return false;
-        }
-        current = current->next;
+    if (edgeIndex.count(edgeKey(sourceId, destId))) {
+        std::cout << "Error: Edge already exists! Use update instead.\n";
+        return false;
     }
 
     // Add new edge at the beginning
-    Edge* newEdge = new Edge(destId, weight);
+    Edge* newEdge = edgePool.allocate(destId, weight);
     newEdge->next = nodes[sourceIndex].adjacencyList;
     nodes[sourceIndex].adjacencyList = newEdge;
 
-    std::cout << "Edge added: " << nodes[sourceIndex].name << " -> "
-              << nodes[destIndex].name << " (weight: " << weight << ")\n";
+    Edge* reverseEdge = edgePool.allocate(sourceId, weight);
+    reverseEdge->next = nodes[destIndex].incomingList;
+    nodes[destIndex].incomingList = reverseEdge;
+    edgeIndex[edgeKey(sourceId, destId)] = {newEdge, reverseEdge};
+
+    nodes[sourceIndex].outDegree++;
+    nodes[destIndex].inDegree++;
+    version++;
+    topologyVersion++;
+    recordEdgeChange(sourceId, destId);
+
+    if (verbose) {
+        std::cout << "Edge added: " << nodes[sourceIndex].name << " -> "
+                  << nodes[destIndex].name << " (weight: " << weight << ")\n";
+    }
     autoSave();
     return true;
 }
@@ -249,42 +440,186 @@ bool Graph::removeEdge(int sourceId, int destId) {
         return false;
     }
 
-    Edge* current = nodes[sourceIndex].adjacencyList;
-    Edge* prev = nullptr;
+    auto it = edgeIndex.find(edgeKey(sourceId, destId));
+    if (it == edgeIndex.end()) {
+        std::cout << "Error: Edge not found!\n";
+        return false;
+    }
 
-    while (current != nullptr) {
-        if (current->destination == destId) {
-            if (prev == nullptr) {
-                nodes[sourceIndex].adjacencyList = current->next;
-            } else {
-                prev->next = current->next;
-            }
-            delete current;
-            std::cout << "Edge removed successfully!\n";
-            autoSave();
-            return true;
-        }
-        prev = current;
-        current = current->next;
+    int destIndex = findNodeIndex(destId);
+    unlinkEdge(nodes[sourceIndex].adjacencyList, it->second.forward);
+    unlinkEdge(nodes[destIndex].incomingList, it->second.reverse);
+    edgeIndex.erase(it);
+
+    nodes[sourceIndex].outDegree--;
+    nodes[destIndex].inDegree--;
+    version++;
+    topologyVersion++;
+    recordEdgeChange(sourceId, destId);
+
+    std::cout << "Edge removed successfully!\n";
+    autoSave();
+    return true;
+}
+
+bool Graph::updateEdgeWeight(int sourceId, int destId, double weight) {
+    if (weight <= 0) {
+        std::cout << "Error: Weight must be positive!\n";
+        return false;
+    }
+
+    auto it = edgeIndex.find(edgeKey(sourceId, destId));
+    if (it == edgeIndex.end()) {
+        std::cout << "Error: Edge not found!\n";
+        return false;
     }
 
-    std::cout << "Error: Edge not found!\n";
-    return false;
+    it->second.forward->weight = weight;
+    it->second.reverse->weight = weight;
+    version++;
+    recordEdgeChange(sourceId, destId);
+
+    std::cout << "Edge updated: " << getNodeName(sourceId) << " -> "
+              << getNodeName(destId) << " (weight: " << weight << ")\n";
+    autoSave();
+    return true;
 }
 
-void Graph::clearNetwork() {
-    for (int i = 0; i < MAX_NODES; i++) {
-        if (nodes[i].active) {
-            clearEdges(i);
-            nodes[i].active = false;
+int Graph::updateEdgeWeights(const std::vector<EdgeWeightUpdate>& updates) {
+    int applied = 0;
+    std::vector<const EdgeWeightUpdate*> appliedUpdates;
+
+    for (const auto& update : updates) {
+        if (update.weight <= 0) continue;
+
+        auto it = edgeIndex.find(edgeKey(update.sourceId, update.destId));
+        if (it == edgeIndex.end()) continue;
+
+        it->second.forward->weight = update.weight;
+        it->second.reverse->weight = update.weight;
+        appliedUpdates.push_back(&update);
+        applied++;
+    }
+
+    // One save for the whole batch instead of one per edge
+    if (applied > 0) {
+        version++;
+        for (const EdgeWeightUpdate* update : appliedUpdates) {
+            recordEdgeChange(update->sourceId, update->destId);
         }
+        autoSave();
+    }
+    return applied;
+}
+
+bool Graph::setNodePosition(int id, double x, double y) {
+    int index = findNodeIndex(id);
+    if (index == -1) {
+        std::cout << "Error: Node with ID " << id << " not found!\n";
+        return false;
+    }
+
+    nodes[index].x = x;
+    nodes[index].y = y;
+    nodes[index].hasPosition = true;
+    version++;
+    autoSave();
+    return true;
+}
+
+bool Graph::addSpeedProfile(const SpeedProfile& profile) {
+    if (profile.id < 0 || profile.points.empty()) {
+        std::cout << "Error: Invalid speed profile!\n";
+        return false;
+    }
+    speedProfiles[profile.id] = profile;
+    version++;
+    return true;
+}
+
+bool Graph::setEdgeProfile(int sourceId, int destId, int profileId) {
+    auto it = edgeIndex.find(edgeKey(sourceId, destId));
+    if (it == edgeIndex.end()) {
+        std::cout << "Error: Edge not found!\n";
+        return false;
+    }
+
+    if (profileId != -1 && speedProfiles.count(profileId) == 0) {
+        std::cout << "Error: Speed profile " << profileId << " not found!\n";
+        return false;
+    }
+
+    it->second.forward->profileId = profileId;
+    it->second.reverse->profileId = profileId;
+    version++;
+    autoSave();
+    return true;
+}
+
+const SpeedProfile* Graph::getSpeedProfile(int profileId) const {
+    auto it = speedProfiles.find(profileId);
+    return it != speedProfiles.end() ? &it->second : nullptr;
+}
+
+double Graph::edgeTravelMinutes(const Edge& edge, double departMinute) const {
+    const SpeedProfile* profile = edge.profileId != -1 ? getSpeedProfile(edge.profileId) : nullptr;
+    if (profile == nullptr) {
+        return edge.weight / DEFAULT_SPEED_KMH * 60.0;
+    }
+    return profile->travelMinutes(edge.weight, departMinute);
+}
+
+bool Graph::setEdgeAttributes(int sourceId, int destId, double freeFlowMinutes, double toll,
+                              unsigned char restrictions) {
+    auto it = edgeIndex.find(edgeKey(sourceId, destId));
+    if (it == edgeIndex.end()) {
+        std::cout << "Error: Edge not found!\n";
+        return false;
     }
+
+    if (freeFlowMinutes < 0 || toll < 0) {
+        std::cout << "Error: Time and toll cannot be negative!\n";
+        return false;
+    }
+
+    for (Edge* edge : {it->second.forward, it->second.reverse}) {
+        edge->freeFlowMinutes = freeFlowMinutes;
+        edge->toll = toll;
+        edge->restrictions = restrictions;
+    }
+    version++;
+    recordEdgeChange(sourceId, destId);
+    autoSave();
+    return true;
+}
+
+bool Graph::hasEdge(int sourceId, int destId) const {
+    return edgeIndex.count(edgeKey(sourceId, destId)) > 0;
+}
+
+double Graph::getEdgeWeight(int sourceId, int destId) const {
+    auto it = edgeIndex.find(edgeKey(sourceId, destId));
+    return it != edgeIndex.end() ? it->second.forward->weight : -1.0;
+}
+
+void Graph::clearNetwork() {
+    // All edges live in the pool, so lists are dropped without walking them
+    nodes.clear();
+    freeSlots = {};
+    edgePool.releaseAll();
+    indexById.clear();
+    edgeIndex.clear();
+    speedProfiles.clear();
+    version++;  // Never reset, so results cached for the old network stay stale
+    topologyVersion++;
+    resetEdgeJournal();
     nodeCount = 0;
     nextId = 0;
     currentFile = "";
 }
 
 bool Graph::loadFromFile(const std::string& filename) {
+    ScopedTimer timer(Operation::NETWORK_LOAD);
     std::ifstream file(filename);
     if (!file.is_open()) {
         std::cout << "Error: Could not open file '" << filename << "'\n";
@@ -310,22 +645,56 @@ bool Graph::loadFromFile(const std::string& filename) {
             std::getline(ss, idStr, ';');
             std::getline(ss, name);
 
+            // Bulk load: errors are still reported, successes only as totals
             int id = std::stoi(idStr);
-            if (addNode(id, name)) {
+            if (addNode(id, name, false)) {
                 nodesLoaded++;
             }
+        } else if (type == "C") {
+            std::string idStr, xStr, yStr;
+            std::getline(ss, idStr, ';');
+            std::getline(ss, xStr, ';');
+            std::getline(ss, yStr);
+
+            setNodePosition(std::stoi(idStr), std::stod(xStr), std::stod(yStr));
+        } else if (type == "P") {
+            std::string idStr, points;
+            std::getline(ss, idStr, ';');
+            std::getline(ss, points);
+
+            SpeedProfile profile;
+            profile.id = std::stoi(idStr);
+            if (SpeedProfile::parse(points, profile)) {
+                addSpeedProfile(profile);
+            } else {
+                std::cout << "Error: Invalid speed profile " << idStr << "\n";
+            }
+        } else if (type == "A") {
+            std::string srcStr, destStr, timeStr, tollStr, classes;
+            std::getline(ss, srcStr, ';');
+            std::getline(ss, destStr, ';');
+            std::getline(ss, timeStr, ';');
+            std::getline(ss, tollStr, ';');
+            std::getline(ss, classes);
+
+            setEdgeAttributes(std::stoi(srcStr), std::stoi(destStr), std::stod(timeStr),
+                              std::stod(tollStr), vehicleClassesFromString(trimLine(classes)));
         } else if (type == "E") {
-            std::string srcStr, destStr, weightStr;
+            std::string srcStr, destStr, weightStr, profileStr;
             std::getline(ss, srcStr, ';');
             std::getline(ss, destStr, ';');
-            std::getline(ss, weightStr);
+            std::getline(ss, weightStr, ';');
+            std::getline(ss, profileStr);
 
             int src = std::stoi(srcStr);
             int dest = std::stoi(destStr);
             double weight = std::stod(weightStr);
 
-            if (addEdge(src, dest, weight)) {
+            if (addEdge(src, dest, weight, false)) {
                 edgesLoaded++;
+                if (!profileStr.empty()) {
+                    setEdgeProfile(src, dest, std::stoi(profileStr));
+                }
             }
         }
     }
@@ -345,31 +714,67 @@ bool Graph::loadFromFile(const std::string& filename) {
     return true;
 }
 
-bool Graph::saveToFile(const std::string& filename) {
-    std::ofstream file(filename);
+bool Graph::loadWeightUpdates(const std::string& filename) {
+    std::ifstream file(filename);
     if (!file.is_open()) {
-        std::cout << "Error: Could not create file '" << filename << "'\n";
+        std::cout << "Error: Could not open file '" << filename << "'\n";
         return false;
     }
 
-    file << "# NODES\n";
-    for (int i = 0; i < MAX_NODES; i++) {
-        if (nodes[i].active) {
-            file << "N;" << nodes[i].id << ";" << nodes[i].name << "\n";
+    const size_t batchSize = 4096;
+    std::vector<EdgeWeightUpdate> batch;
+    batch.reserve(batchSize);
+
+    std::string line;
+    int read = 0;
+    int applied = 0;
+    std::string savedFile = currentFile;
+    currentFile = "";  // Suspend auto-save while batches are applied
+
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') continue;
+
+        std::stringstream ss(line);
+        std::string type, srcStr, destStr, weightStr;
+        std::getline(ss, type, ';');
+        if (type != "W") continue;
+
+        std::getline(ss, srcStr, ';');
+        std::getline(ss, destStr, ';');
+        std::getline(ss, weightStr);
+
+        try {
+            batch.push_back({std::stoi(srcStr), std::stoi(destStr), std::stod(weightStr)});
+        } catch (...) {
+            continue;
         }
-    }
+        read++;
 
-    file << "\n# EDGES\n";
-    for (int i = 0; i < MAX_NODES; i++) {
-        if (nodes[i].active) {
-            Edge* current = nodes[i].adjacencyList;
-            while (current != nullptr) {
-                file << "E;" << nodes[i].id << ";" << current->destination
-                     << ";" << current->weight << "\n";
-                current = current->next;
-            }
+        if (batch.size() >= batchSize) {
+            applied += updateEdgeWeights(batch);
+            batch.clear();
         }
     }
+    applied += updateEdgeWeights(batch);
+
+    file.close();
+    currentFile = savedFile;
+    if (applied > 0) {
+        autoSave();
+    }
+
+    std::cout << "Weight updates read: " << read << " | Applied: " << applied << "\n";
+    return true;
+}
+
+bool Graph::saveToFile(const std::string& filename) {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        std::cout << "Error: Could not create file '" << filename << "'\n";
+        return false;
+    }
+
+    writeNetwork(file);
 
     file.close();
     std::cout << "Network saved successfully to '" << filename << "'\n";
@@ -388,19 +793,10 @@ void Graph::showAdjacencyMatrix() {
 }
 
 bool Graph::nodeExists(int id) const {
-    for (int i = 0; i < MAX_NODES; i++) {
-        if (nodes[i].active && nodes[i].id == id) {
-            return true;
-        }
-    }
-    return false;
+    return findNodeIndex(id) != -1;
 }
 
 std::string Graph::getNodeName(int id) const {
-    for (int i = 0; i < MAX_NODES; i++) {
-        if (nodes[i].active && nodes[i].id == id) {
-            return nodes[i].name;
-        }
-    }
-    return "";
+    int index = findNodeIndex(id);
+    return index != -1 ? nodes[index].name : "";
 }
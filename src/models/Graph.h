@@ -4,36 +4,101 @@
 #include <string>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <unordered_map>
+#include <vector>
+#include <queue>
+#include <functional>
 #include "Node.h"
 #include "Edge.h"
+#include "EdgePool.h"
+#include "SpeedProfile.h"
+#include "VehicleClass.h"
 
-const int MAX_NODES = 50;
+struct EdgeWeightUpdate {
+    int sourceId;
+    int destId;
+    double weight;
+};
 
 class Graph {
 private:
-    Node nodes[MAX_NODES];
+    std::vector<Node> nodes;  // Slots grow on demand, freed slots are reused
+    std::priority_queue<int, std::vector<int>, std::greater<int>> freeSlots;  // Lowest slot first
+    EdgePool edgePool;
     int nodeCount;
     int nextId;
+    unsigned long long version;  // Bumped by every mutation
+    unsigned long long topologyVersion;  // Bumped only when nodes or edges are added/removed
     std::string currentFile;  // Track the currently loaded file
+    std::unordered_map<int, int> indexById;  // Node ID -> array slot
+
+    // (source, destination) -> forward edge and its reverse twin
+    struct EdgeRef {
+        Edge* forward;
+        Edge* reverse;
+    };
+    std::unordered_map<unsigned long long, EdgeRef> edgeIndex;
+    std::map<int, SpeedProfile> speedProfiles;  // Profile ID -> time-of-day speeds
+
+    // Recent edge edits (add, remove, weight or attributes), oldest first, so
+    // incremental consumers can catch up without diffing the whole network
+    struct EdgeChange {
+        unsigned long long version;
+        int sourceId;
+        int destId;
+    };
+    static const size_t EDGE_JOURNAL_LIMIT = 4096;
+    std::vector<EdgeChange> edgeJournal;
+    unsigned long long journalStart;  // Journal is complete for every version after this one
+
+    static unsigned long long edgeKey(int sourceId, int destId) {
+        return ((unsigned long long)(unsigned int)sourceId << 32) | (unsigned int)destId;
+    }
 
+    int acquireSlot();
     void clearEdges(int nodeIndex);
+    void detachNodes(const std::vector<int>& indices);  // Unlink edges touching these slots
+    void freeEdgeList(Edge*& head);
+    int unlinkEdges(Edge*& head, const std::vector<char>& removedSlots, int ownerId = -1);
+    void unlinkEdge(Edge*& head, Edge* target);
     void updateNextId();
     void autoSave();  // Auto-save to current file
+    void recordEdgeChange(int sourceId, int destId);  // Call after bumping version
+    void resetEdgeJournal();  // Changes that the journal cannot express (node removal, reload)
+    void writeNetwork(std::ostream& out) const;
 
 public:
     Graph();
     ~Graph();
 
     // CRUD Operations
-    bool addNode(int id, const std::string& name);
+    bool addNode(int id, const std::string& name, bool verbose = true);  // verbose = per-item success line
     bool addNodeAuto(const std::string& name);  // Auto-increment version
     bool removeNode(int id);
-    bool addEdge(int sourceId, int destId, double weight);
+    int removeNodes(const std::vector<int>& ids);  // Batched removal, returns nodes removed
+    bool addEdge(int sourceId, int destId, double weight, bool verbose = true);
     bool removeEdge(int sourceId, int destId);
+    bool updateEdgeWeight(int sourceId, int destId, double weight);
+    int updateEdgeWeights(const std::vector<EdgeWeightUpdate>& updates);  // Returns updates applied
+
+    bool setNodePosition(int id, double x, double y);
+
+    // Time-dependent speeds
+    bool addSpeedProfile(const SpeedProfile& profile);
+    bool setEdgeProfile(int sourceId, int destId, int profileId);  // -1 clears the profile
+    const SpeedProfile* getSpeedProfile(int profileId) const;
+    const std::map<int, SpeedProfile>& getSpeedProfiles() const { return speedProfiles; }
+    double edgeTravelMinutes(const Edge& edge, double departMinute) const;
+
+    // Multi-criteria attributes (freeFlowMinutes 0 = derive from distance)
+    bool setEdgeAttributes(int sourceId, int destId, double freeFlowMinutes, double toll,
+                           unsigned char restrictions);
 
     // File I/O
     bool loadFromFile(const std::string& filename);
     bool saveToFile(const std::string& filename);
+    bool loadWeightUpdates(const std::string& filename);  // W;source;destination;weight lines
     void clearNetwork();
 
     // Display
@@ -46,10 +111,23 @@ public:
     bool nodeExists(int id) const;
     std::string getNodeName(int id) const;
     std::string getCurrentFile() const { return currentFile; }
-    const Node* getNodes() const { return nodes; }
-    int getMaxNodes() const { return MAX_NODES; }
+    unsigned long long getVersion() const { return version; }  // Cached results compare against this
+    unsigned long long getTopologyVersion() const { return topologyVersion; }
+    // Edges touched after sinceVersion, possibly repeated; false if the journal
+    // no longer covers that version and the caller has to start over
+    bool getEdgeChangesSince(unsigned long long sinceVersion, std::vector<std::pair<int, int>>& changes) const;
+    const Node* getNodes() const { return nodes.data(); }
+    int getMaxNodes() const { return (int)nodes.size(); }  // Number of slots (active or free)
     int findNodeIndex(int id) const;  // Find array index for a node ID
     int getConnectionCount(int nodeId) const;  // Count edges for a node
+    bool hasEdge(int sourceId, int destId) const;
+    double getEdgeWeight(int sourceId, int destId) const;  // -1 if the edge does not exist
+    int getEdgeCount() const { return (int)edgeIndex.size(); }
+
+    // Degree statistics (counters maintained on every edge mutation)
+    int getOutDegree(int nodeId) const;
+    int getInDegree(int nodeId) const;
+    std::map<int, int> getDegreeHistogram(bool incoming = false) const;  // degree -> node count
 };
 
 #endif
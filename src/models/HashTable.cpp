@@ -1,34 +1,109 @@
 #include "HashTable.h"
 #include "utils/colors.h"
 #include "views/VehicleView.h"
+#include "Metrics.h"
 #include <iomanip>
 #include <sstream>
 
-HashTable::HashTable() : vehicleCount(0), nextId(0), currentFile("") {
-    for (int i = 0; i < HASH_SIZE; i++) {
-        table[i].active = false;
+namespace {
+    bool isPrime(int value) {
+        if (value < 2) return false;
+        for (int divisor = 2; (long long)divisor * divisor <= value; divisor++) {
+            if (value % divisor == 0) return false;
+        }
+        return true;
     }
 }
 
+HashTable::HashTable() : table(HASH_SIZE), vehicleCount(0), usedSlots(0), nextId(0), currentFile("") {}
+
 HashTable::~HashTable() {
-    // Nothing to clean up (no dynamic memory)
+    // Nothing to clean up (the vector owns the slots)
+}
+
+HashTable::TableLock::TableLock(const HashTable& owner, bool exclusive) : owner(owner), exclusive(exclusive) {
+    for (LockStripe& stripe : owner.stripes) {
+        if (exclusive) stripe.mutex.lock();
+        else stripe.mutex.lock_shared();
+    }
+}
+
+HashTable::TableLock::~TableLock() {
+    for (int i = LOCK_STRIPES - 1; i >= 0; i--) {
+        if (exclusive) owner.stripes[i].mutex.unlock();
+        else owner.stripes[i].mutex.unlock_shared();
+    }
+}
+
+bool VehicleHandle::read(Vehicle& out) const {
+    if (registry == nullptr) {
+        return false;
+    }
+
+    std::shared_lock<std::shared_mutex> lock(registry->stripeFor(id));
+    int slot = registry->locate(id, slotHint);
+    if (slot == -1) {
+        return false;
+    }
+    out = registry->table[slot];
+    return true;
+}
+
+bool VehicleHandle::moveTo(int currentNodeId, int destinationNodeId) {
+    if (registry == nullptr) {
+        return false;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(registry->stripeFor(id));
+    int slot = registry->locate(id, slotHint);
+    if (slot == -1) {
+        return false;
+    }
+    registry->table[slot].currentNodeId = currentNodeId;
+    registry->table[slot].destinationNodeId = destinationNodeId;
+    slotHint = slot;
+    return true;
+}
+
+int HashTable::hashFunction(int id) const {
+    return (int)((unsigned)id % table.size());  // Non-negative for any ID
 }
 
-int HashTable::hashFunction(int id) {
-    return id % HASH_SIZE;
+void HashTable::growIfNeeded() {
+    if (usedSlots + 1 <= (int)(table.size() * MAX_LOAD_FACTOR)) {
+        return;
+    }
+
+    // Only grow when live vehicles need it; otherwise rehashing just drops deleted markers
+    int capacity = (int)table.size();
+    if (vehicleCount + 1 > (int)(capacity * MAX_LOAD_FACTOR / 2)) {
+        capacity = capacity * 2 + 1;
+        while (!isPrime(capacity)) capacity += 2;
+    }
+
+    std::vector<Vehicle> old(capacity);
+    old.swap(table);
+    usedSlots = 0;
+    for (Vehicle& vehicle : old) {
+        if (vehicle.active) {
+            int index = findSlot(vehicle.id);
+            table[index] = std::move(vehicle);
+            usedSlots++;
+        }
+    }
 }
 
 int HashTable::findSlot(int id) {
+    int size = (int)table.size();
     int index = hashFunction(id);
-    int originalIndex = index;
     int probeCount = 0;
 
-    while (table[index].active && table[index].id != id && probeCount < HASH_SIZE) {
-        index = (index + 1) % HASH_SIZE;  // Linear probing
+    while (table[index].active && table[index].id != id && probeCount < size) {
+        index = (index + 1) % size;  // Linear probing
         probeCount++;
     }
 
-    if (probeCount >= HASH_SIZE) {
+    if (probeCount >= size) {
         return -1;  // Table is full
     }
 
@@ -37,7 +112,7 @@ int HashTable::findSlot(int id) {
 
 void HashTable::updateNextId() {
     int maxId = -1;
-    for (int i = 0; i < HASH_SIZE; i++) {
+    for (int i = 0; i < (int)table.size(); i++) {
         if (table[i].active && table[i].id > maxId) {
             maxId = table[i].id;
         }
@@ -45,6 +120,60 @@ void HashTable::updateNextId() {
     nextId = maxId + 1;
 }
 
+int HashTable::locate(int id) const {
+    int size = (int)table.size();
+    int index = hashFunction(id);
+    int probeCount = 0;
+
+    while (probeCount < size) {
+        if (table[index].active && table[index].id == id) {
+            return index;
+        }
+
+        if (!table[index].active && table[index].id == -1) {
+            break;  // Never been used, vehicle doesn't exist
+        }
+
+        index = (index + 1) % size;
+        probeCount++;
+    }
+
+    return -1;
+}
+
+int HashTable::locate(int id, int slotHint) const {
+    if (slotHint >= 0 && slotHint < (int)table.size() &&
+        table[slotHint].active && table[slotHint].id == id) {
+        return slotHint;
+    }
+    return locate(id);
+}
+
+bool HashTable::insert(int id, const std::string& plate, const std::string& type, int origin, int dest) {
+    growIfNeeded();
+    int index = findSlot(id);
+    if (index == -1) {
+        std::cout << "Error: Could not find slot for vehicle!\n";
+        return false;
+    }
+
+    if (table[index].id == -1) usedSlots++;
+    table[index] = Vehicle(id, plate, type, origin, dest);
+    vehicleCount++;
+    return true;
+}
+
+void HashTable::writeVehicles(std::ostream& out) const {
+    out << "# VEHICLES\n";
+    for (int i = 0; i < (int)table.size(); i++) {
+        if (table[i].active) {
+            out << "V;" << table[i].id << ";" << table[i].plate << ";"
+                << table[i].type << ";" << table[i].currentNodeId << ";"
+                << table[i].destinationNodeId << "\n";
+        }
+    }
+}
+
 void HashTable::autoSave() {
     if (!currentFile.empty()) {
         std::ofstream file(currentFile);
@@ -52,25 +181,14 @@ void HashTable::autoSave() {
             return;
         }
 
-        file << "# VEHICLES\n";
-        for (int i = 0; i < HASH_SIZE; i++) {
-            if (table[i].active) {
-                file << "V;" << table[i].id << ";" << table[i].plate << ";"
-                     << table[i].type << ";" << table[i].currentNodeId << ";"
-                     << table[i].destinationNodeId << "\n";
-            }
-        }
-
+        writeVehicles(file);
         file.close();
     }
 }
 
-bool HashTable::addVehicle(int id, const std::string& plate, const std::string& type, int origin, int dest) {
-    if (vehicleCount >= HASH_SIZE) {
-        std::cout << "Error: Hash table is full!\n";
-        return false;
-    }
-
+bool HashTable::addVehicle(int id, const std::string& plate, const std::string& type, int origin, int dest,
+                           bool verbose) {
+    ScopedTimer timer(Operation::VEHICLE_ADD);
     if (plate.empty()) {
         std::cout << "Error: Plate cannot be empty!\n";
         return false;
@@ -81,35 +199,31 @@ bool HashTable::addVehicle(int id, const std::string& plate, const std::string&
         return false;
     }
 
-    int index = findSlot(id);
-    if (index == -1) {
-        std::cout << "Error: Could not find slot for vehicle!\n";
-        return false;
-    }
+    TableLock lock(*this, true);
 
-    if (table[index].active && table[index].id == id) {
+    // Checked before probing: a deleted slot ahead of the vehicle would end findSlot early
+    if (locate(id) != -1) {
         std::cout << "Error: Vehicle with ID " << id << " already exists!\n";
         return false;
     }
 
-    table[index] = Vehicle(id, plate, type, origin, dest);
-    vehicleCount++;
+    if (!insert(id, plate, type, origin, dest)) {
+        return false;
+    }
 
     if (id >= nextId) {
         nextId = id + 1;
     }
 
-    std::cout << "Vehicle added successfully: [" << id << "] " << plate << " (" << type << ")\n";
+    if (verbose) {
+        std::cout << "Vehicle added successfully: [" << id << "] " << plate << " (" << type << ")\n";
+    }
     autoSave();
     return true;
 }
 
 bool HashTable::addVehicleAuto(const std::string& plate, const std::string& type, int origin, int dest) {
-    if (vehicleCount >= HASH_SIZE) {
-        std::cout << "Error: Hash table is full!\n";
-        return false;
-    }
-
+    ScopedTimer timer(Operation::VEHICLE_ADD);
     if (plate.empty()) {
         std::cout << "Error: Plate cannot be empty!\n";
         return false;
@@ -120,16 +234,12 @@ bool HashTable::addVehicleAuto(const std::string& plate, const std::string& type
         return false;
     }
 
-    int id = nextId;
-    int index = findSlot(id);
+    TableLock lock(*this, true);
 
-    if (index == -1) {
-        std::cout << "Error: Could not find slot for vehicle!\n";
+    int id = nextId;
+    if (!insert(id, plate, type, origin, dest)) {
         return false;
     }
-
-    table[index] = Vehicle(id, plate, type, origin, dest);
-    vehicleCount++;
     nextId++;
 
     std::cout << "Vehicle added successfully: [" << id << "] " << plate << " (" << type << ")\n";
@@ -138,53 +248,93 @@ bool HashTable::addVehicleAuto(const std::string& plate, const std::string& type
 }
 
 bool HashTable::removeVehicle(int id) {
-    int index = hashFunction(id);
-    int originalIndex = index;
-    int probeCount = 0;
+    ScopedTimer timer(Operation::VEHICLE_REMOVE);
+    TableLock lock(*this, true);
 
-    while (probeCount < HASH_SIZE) {
-        if (table[index].active && table[index].id == id) {
-            table[index].active = false;
-            vehicleCount--;
-            std::cout << "Vehicle removed successfully: [" << id << "]\n";
-            autoSave();
-            return true;
-        }
+    int index = locate(id);
+    if (index == -1) {
+        std::cout << "Error: Vehicle with ID " << id << " not found!\n";
+        return false;
+    }
 
-        if (!table[index].active && table[index].id == -1) {
-            break;  // Never been used, vehicle doesn't exist
-        }
+    table[index].active = false;
+    vehicleCount--;
+    std::cout << "Vehicle removed successfully: [" << id << "]\n";
+    autoSave();
+    return true;
+}
 
-        index = (index + 1) % HASH_SIZE;
-        probeCount++;
-    }
+VehicleHandle HashTable::searchVehicle(int id) {
+    ScopedTimer timer(Operation::VEHICLE_SEARCH, shouldSample(Operation::VEHICLE_SEARCH));
+    std::shared_lock<std::shared_mutex> lock(stripeFor(id));
 
-    std::cout << "Error: Vehicle with ID " << id << " not found!\n";
-    return false;
+    int index = locate(id);
+    return index == -1 ? VehicleHandle() : VehicleHandle(this, id, index);
 }
 
-Vehicle* HashTable::searchVehicle(int id) {
-    int index = hashFunction(id);
-    int originalIndex = index;
-    int probeCount = 0;
+bool HashTable::vehicleExists(int id) const {
+    std::shared_lock<std::shared_mutex> lock(stripeFor(id));
+    return locate(id) != -1;
+}
 
-    while (probeCount < HASH_SIZE) {
-        if (table[index].active && table[index].id == id) {
-            return &table[index];
-        }
+bool HashTable::getVehicle(int id, Vehicle& out) const {
+    std::shared_lock<std::shared_mutex> lock(stripeFor(id));
+    int index = locate(id);
+    if (index == -1) {
+        return false;
+    }
+    out = table[index];
+    return true;
+}
 
-        if (!table[index].active && table[index].id == -1) {
-            break;
-        }
+bool HashTable::updatePosition(int id, int currentNodeId, int destinationNodeId) {
+    std::unique_lock<std::shared_mutex> lock(stripeFor(id));
+    int index = locate(id);
+    if (index == -1) {
+        return false;
+    }
+    table[index].currentNodeId = currentNodeId;
+    table[index].destinationNodeId = destinationNodeId;
+    return true;
+}
 
-        index = (index + 1) % HASH_SIZE;
-        probeCount++;
+PositionFix HashTable::applyPositionFix(int id, int nodeId, long long timestamp) {
+    std::unique_lock<std::shared_mutex> lock(stripeFor(id));
+    int index = locate(id);
+    if (index == -1) {
+        return PositionFix::UNKNOWN_VEHICLE;
+    }
+
+    Vehicle& vehicle = table[index];
+    if (timestamp < vehicle.lastFixTime) {
+        return PositionFix::STALE;
+    }
+
+    vehicle.lastFixTime = timestamp;
+    if (vehicle.currentNodeId == nodeId) {
+        return PositionFix::UNCHANGED;
     }
+    vehicle.currentNodeId = nodeId;
+    return PositionFix::MOVED;
+}
+
+int HashTable::getVehicleCount() const {
+    std::shared_lock<std::shared_mutex> lock(stripes[0].mutex);  // Counters change under every stripe
+    return vehicleCount;
+}
+
+int HashTable::getNextId() const {
+    std::shared_lock<std::shared_mutex> lock(stripes[0].mutex);
+    return nextId;
+}
 
-    return nullptr;
+std::string HashTable::getCurrentFile() const {
+    std::shared_lock<std::shared_mutex> lock(stripes[0].mutex);
+    return currentFile;
 }
 
 bool HashTable::loadFromFile(const std::string& filename) {
+    ScopedTimer timer(Operation::VEHICLE_LOAD);
     std::ifstream file(filename);
     if (!file.is_open()) {
         std::cout << "Error: Could not open file '" << filename << "'\n";
@@ -215,15 +365,18 @@ bool HashTable::loadFromFile(const std::string& filename) {
             int origin = std::stoi(originStr);
             int dest = std::stoi(destStr);
 
-            if (addVehicle(id, plate, vType, origin, dest)) {
+            if (addVehicle(id, plate, vType, origin, dest, false)) {  // Totals only
                 vehiclesLoaded++;
             }
         }
     }
 
     file.close();
-    updateNextId();
-    currentFile = filename;
+    {
+        TableLock lock(*this, true);
+        updateNextId();
+        currentFile = filename;
+    }
 
     std::cout << "\nVehicles loaded successfully!\n";
     std::cout << "Total vehicles: " << vehiclesLoaded << "\n";
@@ -238,13 +391,9 @@ bool HashTable::saveToFile(const std::string& filename) {
         return false;
     }
 
-    file << "# VEHICLES\n";
-    for (int i = 0; i < HASH_SIZE; i++) {
-        if (table[i].active) {
-            file << "V;" << table[i].id << ";" << table[i].plate << ";"
-                 << table[i].type << ";" << table[i].currentNodeId << ";"
-                 << table[i].destinationNodeId << "\n";
-        }
+    {
+        TableLock lock(*this, false);
+        writeVehicles(file);
     }
 
     file.close();
@@ -253,10 +402,10 @@ bool HashTable::saveToFile(const std::string& filename) {
 }
 
 void HashTable::clearTable() {
-    for (int i = 0; i < HASH_SIZE; i++) {
-        table[i].active = false;
-    }
+    TableLock lock(*this, true);
+    table.assign(HASH_SIZE, Vehicle());
     vehicleCount = 0;
+    usedSlots = 0;
     nextId = 0;
     currentFile = "";
 }
@@ -267,18 +416,14 @@ void HashTable::showAllVehicles() {
 }
 
 void HashTable::showHashInfo() {
+    TableLock lock(*this, false);
     std::cout << "\n" << BOLD << "Hash table statistics" << RESET << "\n";
 
     // Calculate statistics
-    int usedSlots = 0;
-    for (int i = 0; i < HASH_SIZE; i++) {
-        if (table[i].active || table[i].id != -1) {
-            usedSlots++;
-        }
-    }
-    double loadFactor = (double)vehicleCount / HASH_SIZE;
-    int availableCapacity = HASH_SIZE - vehicleCount;
-    double usagePercent = (double)vehicleCount / HASH_SIZE * 100;
+    int capacity = (int)table.size();
+    double loadFactor = (double)vehicleCount / capacity;
+    int availableCapacity = (int)(capacity * MAX_LOAD_FACTOR) - usedSlots;  // Before the next rehash
+    double usagePercent = (double)vehicleCount / capacity * 100;
     int collisions = usedSlots - vehicleCount;
 
     // Main statistics table
@@ -303,13 +448,13 @@ void HashTable::showHashInfo() {
 
     // Storage capacity
     std::cout << std::setw(25) << "Storage capacity" << " | "
-              << std::setw(15) << HASH_SIZE << " | "
-              << std::setw(30) << "Maximum slots" << "\n";
+              << std::setw(15) << capacity << " | "
+              << std::setw(30) << "Grows automatically" << "\n";
 
     // Available space
     std::cout << std::setw(25) << "Available space" << " | "
               << std::setw(15) << availableCapacity << " | "
-              << std::setw(30) << "Slots remaining" << "\n";
+              << std::setw(30) << "Slots before next resize" << "\n";
 
     // Usage percentage
     std::cout << std::setw(25) << "Usage percentage" << " | "
@@ -341,7 +486,7 @@ void HashTable::showHashInfo() {
 
     // Occupied slots
     std::cout << std::setw(25) << "Occupied slots" << " | "
-              << std::setw(15) << (std::to_string(usedSlots) + " / " + std::to_string(HASH_SIZE)) << " | "
+              << std::setw(15) << (std::to_string(usedSlots) + " / " + std::to_string(capacity)) << " | "
               << std::setw(30) << "Actual positions used" << "\n";
 
     // Collisions
@@ -389,6 +534,7 @@ void HashTable::showHashInfo() {
 
 void HashTable::logMovement(int vehicleId, int destNodeId, const std::string& status,
                            double travelTime, const std::string& failReason) {
+    std::lock_guard<std::mutex> lock(movementLogMutex);
     std::ofstream file("data/.movements.csv", std::ios::app);
     if (!file.is_open()) {
         return;
@@ -400,6 +546,24 @@ void HashTable::logMovement(int vehicleId, int destNodeId, const std::string& st
     file.close();
 }
 
+void HashTable::logMovements(const std::vector<Movement>& movements) {
+    if (movements.empty()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(movementLogMutex);
+    std::ofstream file("data/.movements.csv", std::ios::app);
+    if (!file.is_open()) {
+        return;
+    }
+
+    for (const Movement& movement : movements) {
+        file << movement.vehicleId << ";" << movement.destinationNodeId << ";" << movement.status << ";"
+             << movement.travelTimeMinutes << ";" << movement.failReason << "\n";
+    }
+    file.close();
+}
+
 void HashTable::showMovementHistory() {
     std::ifstream file("data/.movements.csv");
     if (!file.is_open()) {
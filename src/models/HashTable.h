@@ -4,19 +4,92 @@
 #include <string>
 #include <fstream>
 #include <iostream>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
 #include "Vehicle.h"
 
-const int HASH_SIZE = 101;  // Prime number for better distribution
+const int HASH_SIZE = 101;  // Initial capacity, prime number for better distribution
+const double MAX_LOAD_FACTOR = 0.7;  // Grow once live + deleted slots pass this fraction
+const int LOCK_STRIPES = 16;  // Reader/writer locks, picked by vehicle ID
 
+class HashTable;
+
+// Outcome of one telemetry position fix
+enum class PositionFix {
+    MOVED,            // Vehicle now at the reported node
+    UNCHANGED,        // Already there; only the timestamp advanced
+    STALE,            // Older than the last fix applied to this vehicle
+    UNKNOWN_VEHICLE
+};
+
+// Reference to a registered vehicle by ID, never a pointer into the table:
+// growth, removal and concurrent updates cannot leave it dangling. The slot
+// found at lookup is kept as a hint and re-checked on every use, so a
+// handle costs no extra probing while the table is unchanged.
+class VehicleHandle {
+private:
+    HashTable* registry;
+    int id;
+    int slotHint;
+
+    friend class HashTable;
+    VehicleHandle(HashTable* registry, int id, int slot) : registry(registry), id(id), slotHint(slot) {}
+
+public:
+    VehicleHandle() : registry(nullptr), id(-1), slotHint(-1) {}
+
+    explicit operator bool() const { return registry != nullptr; }  // Found at lookup time
+    int getId() const { return id; }
+
+    bool read(Vehicle& out) const;  // Copy of the current state; false once removed
+    bool moveTo(int currentNodeId, int destinationNodeId);
+};
+
+// Open-addressing vehicle registry, safe to share between threads. Each
+// vehicle ID maps to one of LOCK_STRIPES reader/writer locks: lookups take
+// their stripe shared and position updates take it exclusive, so readers
+// and writers of different stripes never wait on each other. Anything that
+// moves slots (add, remove, growth, load, clear) takes every stripe.
+// Probing reads only the id/active fields, which change under all stripes,
+// so a lookup is never disturbed by position updates in other stripes.
 class HashTable {
 private:
-    Vehicle table[HASH_SIZE];
+    std::vector<Vehicle> table;
     int vehicleCount;
+    int usedSlots;   // Live vehicles plus deleted markers (id != -1), what probing walks over
     int nextId;
     std::string currentFile;
 
-    int hashFunction(int id);
+    struct alignas(64) LockStripe {  // One per cache line, so stripes do not false-share
+        std::shared_mutex mutex;
+    };
+    mutable LockStripe stripes[LOCK_STRIPES];
+    std::mutex movementLogMutex;
+
+    // Every stripe, in index order, for structural changes (or whole-table reads)
+    class TableLock {
+    private:
+        const HashTable& owner;
+        bool exclusive;
+    public:
+        TableLock(const HashTable& owner, bool exclusive);
+        ~TableLock();
+        TableLock(const TableLock&) = delete;
+        TableLock& operator=(const TableLock&) = delete;
+    };
+
+    std::shared_mutex& stripeFor(int id) const { return stripes[(unsigned)id % LOCK_STRIPES].mutex; }
+
+    friend class VehicleHandle;
+
+    int hashFunction(int id) const;
     int findSlot(int id);  // Linear probing
+    int locate(int id) const;  // Slot of a live vehicle or -1; caller holds a lock
+    int locate(int id, int slotHint) const;
+    void growIfNeeded();   // Rehash into a larger prime capacity; slots move
+    bool insert(int id, const std::string& plate, const std::string& type, int origin, int dest);
+    void writeVehicles(std::ostream& out) const;
     void autoSave();
     void updateNextId();
 
@@ -25,10 +98,19 @@ public:
     ~HashTable();
 
     // CRUD Operations
-    bool addVehicle(int id, const std::string& plate, const std::string& type, int origin, int dest);
+    bool addVehicle(int id, const std::string& plate, const std::string& type, int origin, int dest,
+                    bool verbose = true);  // verbose = per-vehicle success line
     bool addVehicleAuto(const std::string& plate, const std::string& type, int origin, int dest);
     bool removeVehicle(int id);
-    Vehicle* searchVehicle(int id);
+    VehicleHandle searchVehicle(int id);
+    bool vehicleExists(int id) const;
+
+    // Thread-safe access by ID
+    bool getVehicle(int id, Vehicle& out) const;  // Copy of the current state
+    bool updatePosition(int id, int currentNodeId, int destinationNodeId);
+    // Telemetry: move to nodeId unless a newer fix was already applied, so
+    // fixes arriving out of order from parallel workers settle on the latest
+    PositionFix applyPositionFix(int id, int nodeId, long long timestamp);
 
     // File I/O
     bool loadFromFile(const std::string& filename);
@@ -39,17 +121,19 @@ public:
     void showAllVehicles();
     void showHashInfo();
 
-    // Movement tracking
+    // Movement tracking (appends are serialized)
     void logMovement(int vehicleId, int destNodeId, const std::string& status,
                     double travelTime, const std::string& failReason = "");
+    void logMovements(const std::vector<Movement>& movements);  // One append for the whole batch
     void showMovementHistory();
 
     // Getters
-    int getVehicleCount() const { return vehicleCount; }
-    int getNextId() const { return nextId; }
-    std::string getCurrentFile() const { return currentFile; }
-    const Vehicle* getVehicles() const { return table; }
-    int getHashSize() const { return HASH_SIZE; }
+    int getVehicleCount() const;
+    int getNextId() const;
+    std::string getCurrentFile() const;
+    // Raw slots for the UI views; not for use while other threads update positions
+    const Vehicle* getVehicles() const { return table.data(); }
+    int getHashSize() const { return (int)table.size(); }
 };
 
 #endif
@@ -8,9 +8,16 @@ struct Node {
     int id;
     std::string name;
     Edge* adjacencyList;
+    Edge* incomingList;  // Reverse edges: destination holds the source node ID
+    int outDegree;
+    int inDegree;
+    double x;            // Optional map position (used for locality ordering)
+    double y;
+    bool hasPosition;
     bool active;
 
-    Node() : id(-1), name(""), adjacencyList(nullptr), active(false) {}
+    Node() : id(-1), name(""), adjacencyList(nullptr), incomingList(nullptr), outDegree(0), inDegree(0),
+             x(0.0), y(0.0), hasPosition(false), active(false) {}
 };
 
 #endif
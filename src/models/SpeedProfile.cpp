@@ -0,0 +1,110 @@
+#include "SpeedProfile.h"
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+namespace {
+    const double MIN_SPEED_KMH = 1.0;  // Keeps travel time finite on a stalled road
+
+    double wrapMinute(double minute) {
+        double wrapped = std::fmod(minute, MINUTES_PER_DAY);
+        return wrapped < 0 ? wrapped + MINUTES_PER_DAY : wrapped;
+    }
+}
+
+double SpeedProfile::speedAt(double minuteOfDay) const {
+    if (points.empty()) return DEFAULT_SPEED_KMH;
+    if (points.size() == 1) return std::max(points[0].second, MIN_SPEED_KMH);
+
+    double t = wrapMinute(minuteOfDay);
+
+    // First breakpoint strictly after t
+    auto upper = std::upper_bound(points.begin(), points.end(), t,
+        [](double value, const std::pair<double, double>& point) { return value < point.first; });
+
+    std::pair<double, double> a, b;
+    if (upper == points.begin() || upper == points.end()) {
+        // Wrap segment: last breakpoint -> first breakpoint of the next day
+        a = points.back();
+        b = {points.front().first + MINUTES_PER_DAY, points.front().second};
+        if (t < a.first) t += MINUTES_PER_DAY;
+    } else {
+        a = *(upper - 1);
+        b = *upper;
+    }
+
+    double span = b.first - a.first;
+    double speed = span > 0 ? a.second + (b.second - a.second) * (t - a.first) / span : a.second;
+    return std::max(speed, MIN_SPEED_KMH);
+}
+
+double SpeedProfile::travelMinutes(double distanceKm, double departMinute) const {
+    if (distanceKm <= 0) return 0.0;
+    if (points.size() < 2) return distanceKm / speedAt(departMinute) * 60.0;
+
+    double elapsed = 0.0;
+    double remaining = distanceKm;
+    double t = wrapMinute(departMinute);
+
+    // Integrate segment by segment; speed is linear inside each one
+    for (int guard = 0; guard < 100000 && remaining > 0; guard++) {
+        auto upper = std::upper_bound(points.begin(), points.end(), t,
+            [](double value, const std::pair<double, double>& point) { return value < point.first; });
+        double segmentEnd = (upper == points.end()) ? points.front().first + MINUTES_PER_DAY : upper->first;
+        double window = segmentEnd - t;
+
+        double v0 = speedAt(t);
+        double v1 = speedAt(segmentEnd - 1e-9);
+        double accel = window > 0 ? (v1 - v0) / window : 0.0;  // km/h per minute
+
+        // Distance (km) over tau minutes: (v0 * tau + accel * tau^2 / 2) / 60
+        double segmentKm = (v0 * window + accel * window * window / 2.0) / 60.0;
+        if (segmentKm >= remaining) {
+            double tau;
+            if (std::fabs(accel) < 1e-12) {
+                tau = remaining * 60.0 / v0;
+            } else {
+                double disc = v0 * v0 + 2.0 * accel * remaining * 60.0;
+                tau = (-v0 + std::sqrt(std::max(disc, 0.0))) / accel;
+            }
+            return elapsed + tau;
+        }
+
+        remaining -= segmentKm;
+        elapsed += window;
+        t = wrapMinute(segmentEnd);
+    }
+
+    return elapsed;
+}
+
+std::string SpeedProfile::toString() const {
+    std::ostringstream out;
+    for (size_t i = 0; i < points.size(); i++) {
+        if (i > 0) out << ",";
+        out << points[i].first << ":" << points[i].second;
+    }
+    return out.str();
+}
+
+bool SpeedProfile::parse(const std::string& text, SpeedProfile& profile) {
+    profile.points.clear();
+
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        size_t colon = item.find(':');
+        if (colon == std::string::npos) return false;
+        try {
+            double minute = std::stod(item.substr(0, colon));
+            double speed = std::stod(item.substr(colon + 1));
+            if (minute < 0 || minute >= MINUTES_PER_DAY || speed <= 0) return false;
+            profile.points.push_back({minute, speed});
+        } catch (...) {
+            return false;
+        }
+    }
+
+    std::sort(profile.points.begin(), profile.points.end());
+    return !profile.points.empty();
+}
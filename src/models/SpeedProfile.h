@@ -0,0 +1,29 @@
+#ifndef SPEEDPROFILE_H
+#define SPEEDPROFILE_H
+
+#include <string>
+#include <vector>
+#include <utility>
+
+const double DEFAULT_SPEED_KMH = 60.0;   // Used by edges without a profile
+const double MINUTES_PER_DAY = 1440.0;
+
+// Piecewise-linear speed by time of day: (minute of day, km/h) breakpoints.
+// Speed between the last and first breakpoint wraps around midnight.
+struct SpeedProfile {
+    int id;
+    std::vector<std::pair<double, double>> points;
+
+    SpeedProfile() : id(-1) {}
+
+    double speedAt(double minuteOfDay) const;
+
+    // Minutes needed to cover distanceKm when entering the edge at departMinute
+    double travelMinutes(double distanceKm, double departMinute) const;
+
+    // "minute:speed,minute:speed" as used in P; lines of network files
+    std::string toString() const;
+    static bool parse(const std::string& text, SpeedProfile& profile);
+};
+
+#endif
@@ -1,8 +1,11 @@
 #ifndef VEHICLE_H
 #define VEHICLE_H
 
+#include <limits>
 #include <string>
 
+const long long NO_FIX_TIME = std::numeric_limits<long long>::min();
+
 struct Vehicle {
     int id;
     std::string plate;
@@ -10,10 +13,13 @@ struct Vehicle {
     int currentNodeId;
     int destinationNodeId;
     bool active;
+    long long lastFixTime;  // Timestamp of the latest telemetry position, NO_FIX_TIME if none
 
-    Vehicle() : id(-1), plate(""), type(""), currentNodeId(-1), destinationNodeId(-1), active(false) {}
+    Vehicle() : id(-1), plate(""), type(""), currentNodeId(-1), destinationNodeId(-1), active(false),
+                lastFixTime(NO_FIX_TIME) {}
     Vehicle(int i, const std::string& p, const std::string& t, int curr, int dest)
-        : id(i), plate(p), type(t), currentNodeId(curr), destinationNodeId(dest), active(true) {}
+        : id(i), plate(p), type(t), currentNodeId(curr), destinationNodeId(dest), active(true),
+          lastFixTime(NO_FIX_TIME) {}
 };
 
 struct Movement {
@@ -0,0 +1,43 @@
+#ifndef VEHICLECLASS_H
+#define VEHICLECLASS_H
+
+#include <string>
+#include <sstream>
+
+// Vehicle classes as bit flags, matching Vehicle::type values
+const unsigned char VEHICLE_CLASS_NONE = 0;
+const unsigned char VEHICLE_CLASS_SEDAN = 1;
+const unsigned char VEHICLE_CLASS_COMPACT = 2;
+const unsigned char VEHICLE_CLASS_TRUCK = 4;
+
+inline unsigned char vehicleClassFromType(const std::string& type) {
+    if (type == "Sedan") return VEHICLE_CLASS_SEDAN;
+    if (type == "Compact") return VEHICLE_CLASS_COMPACT;
+    if (type == "Truck") return VEHICLE_CLASS_TRUCK;
+    return VEHICLE_CLASS_NONE;
+}
+
+// "Truck|Sedan" <-> mask, as stored in A; lines of network files
+inline std::string vehicleClassesToString(unsigned char mask) {
+    std::string result;
+    const char* names[] = {"Sedan", "Compact", "Truck"};
+    for (int i = 0; i < 3; i++) {
+        if (mask & (1 << i)) {
+            if (!result.empty()) result += "|";
+            result += names[i];
+        }
+    }
+    return result;
+}
+
+inline unsigned char vehicleClassesFromString(const std::string& text) {
+    unsigned char mask = VEHICLE_CLASS_NONE;
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, '|')) {
+        mask |= vehicleClassFromType(item);
+    }
+    return mask;
+}
+
+#endif
@@ -1,8 +1,20 @@
 #include "FileService.h"
 #include "utils/colors.h"
+#include "Metrics.h"
 #include <fstream>
 #include <iostream>
 #include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+namespace {
+    // Formatted apart so std::cout keeps its default float format
+    std::string formatSeconds(double seconds) {
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(2) << seconds << " s";
+        return out.str();
+    }
+}
 
 FileService::FileService() {}
 
@@ -52,6 +64,10 @@ std::string FileService::getSeedPath(const std::string& filename) {
     return "seeds/" + sanitizeFilename(filename) + ".csv";
 }
 
+std::string FileService::getMatrixPath(const std::string& filename) {
+    return "data/" + sanitizeFilename(filename) + ".dmx";
+}
+
 // EXTRACTED from Graph::loadFromFile
 bool FileService::loadNetwork(const std::string& filename, Graph& network) {
     std::string fullPath = getDataPath(filename);
@@ -66,6 +82,106 @@ bool FileService::saveNetwork(const std::string& filename, Graph& network) {
     return network.saveToFile(fullPath);
 }
 
+// Bulk edge weight updates (traffic feeds)
+bool FileService::applyWeightUpdates(const std::string& filename, Graph& network) {
+    std::string fullPath = getDataPath(filename);
+    std::cout << "Applying updates from: " << fullPath << "\n\n";
+    return network.loadWeightUpdates(fullPath);
+}
+
+bool FileService::exportServiceAreas(const std::string& filename, const Graph& network,
+                                     const std::vector<ServiceArea>& areas, double budget) {
+    std::string sanitized = sanitizeFilename(filename);
+    if (sanitized.empty()) {
+        std::cout << RED << "Error: Invalid filename!" << RESET << "\n";
+        return false;
+    }
+
+    std::string fullPath = getDataPath(sanitized);
+    std::ofstream file(fullPath);
+    if (!file.is_open()) {
+        std::cout << RED << "Error: Could not create export file!" << RESET << "\n";
+        return false;
+    }
+
+    file << "# SERVICE AREAS (budget " << budget << ")\n";
+    file << "# node;name;reachable;farthest\n";
+    for (const ServiceArea& area : areas) {
+        file << area.nodeId << ";" << network.getNodeName(area.nodeId) << ";"
+             << area.reachableCount << ";" << area.farthestCost << "\n";
+    }
+
+    file.close();
+    std::cout << "Service areas exported to: " << fullPath << "\n";
+    return true;
+}
+
+bool FileService::exportPerformanceStats(const std::string& filename) {
+    std::string sanitized = sanitizeFilename(filename);
+    if (sanitized.empty()) {
+        std::cout << RED << "Error: Invalid filename!" << RESET << "\n";
+        return false;
+    }
+
+    std::string fullPath = getDataPath(sanitized);
+    std::ofstream file(fullPath);
+    if (!file.is_open()) {
+        std::cout << RED << "Error: Could not create export file!" << RESET << "\n";
+        return false;
+    }
+
+    // S lines: one summary per operation (latencies in microseconds); count is
+    // the exact call count, latencies come from 1 call in sample_interval
+    // H lines: non-empty buckets, so the distribution can be re-plotted; these count timed calls
+    file << "# PERFORMANCE STATS\n";
+    file << "# S;operation;count;mean_us;p50_us;p90_us;p99_us;p999_us;max_us;nodes_settled;edges_relaxed;queue_pushes;"
+            "sample_interval\n";
+    file << "# H;operation;bucket_upper_ns;count\n";
+    file << std::fixed << std::setprecision(3);
+    for (int i = 0; i < OPERATION_COUNT; i++) {
+        Operation operation = (Operation)i;
+        const LatencyHistogram& histogram = metrics().getLatency(operation);
+        file << "S;" << operationName(operation) << ";" << metrics().getCallCount(operation) << ";"
+             << histogram.getMean() / 1000.0 << ";"
+             << histogram.percentile(50.0) / 1000.0 << ";"
+             << histogram.percentile(90.0) / 1000.0 << ";"
+             << histogram.percentile(99.0) / 1000.0 << ";"
+             << histogram.percentile(99.9) / 1000.0 << ";"
+             << histogram.getMax() / 1000.0 << ";"
+             << metrics().getCounter(operation, Counter::NODES_SETTLED) << ";"
+             << metrics().getCounter(operation, Counter::EDGES_RELAXED) << ";"
+             << metrics().getCounter(operation, Counter::QUEUE_PUSHES) << ";"
+             << sampleInterval(operation) << "\n";
+    }
+    for (int i = 0; i < OPERATION_COUNT; i++) {
+        Operation operation = (Operation)i;
+        const LatencyHistogram& histogram = metrics().getLatency(operation);
+        for (int bucket = 0; bucket < LatencyHistogram::BUCKET_COUNT; bucket++) {
+            unsigned long long samples = histogram.getBucketCount(bucket);
+            if (samples > 0) {
+                file << "H;" << operationName(operation) << ";"
+                     << LatencyHistogram::bucketUpperBound(bucket) << ";" << samples << "\n";
+            }
+        }
+    }
+
+    file.close();
+    std::cout << "Performance stats exported to: " << fullPath << "\n";
+    return true;
+}
+
+bool FileService::saveDistrictMatrix(const std::string& filename, const DistrictMatrix& matrix) {
+    std::string fullPath = getMatrixPath(filename);
+    std::cout << "Saving to: " << fullPath << "\n\n";
+    return matrix.saveToFile(fullPath);
+}
+
+bool FileService::loadDistrictMatrix(const std::string& filename, DistrictMatrix& matrix, const Graph& network) {
+    std::string fullPath = getMatrixPath(filename);
+    std::cout << "Loading from: " << fullPath << "\n\n";
+    return matrix.loadFromFile(fullPath, network);
+}
+
 // EXTRACTED from HashTable::loadFromFile
 bool FileService::loadVehicles(const std::string& filename, HashTable& registry) {
     std::string fullPath = getDataPath(filename);
@@ -80,6 +196,31 @@ bool FileService::saveVehicles(const std::string& filename, HashTable& registry)
     return registry.saveToFile(fullPath);
 }
 
+bool FileService::ingestTelemetry(const std::string& filename, HashTable& registry, const Graph& network,
+                                  const IngestOptions& options) {
+    std::string fullPath = getDataPath(filename);
+    std::cout << "Replaying from: " << fullPath << "\n\n";
+
+    IngestService ingest;
+    IngestStats stats;
+    if (!ingest.ingestFile(fullPath, registry, network, options, stats)) {
+        std::cout << RED << "Error: Could not read telemetry from '" << fullPath << "'" << RESET << "\n";
+        return false;
+    }
+
+    std::cout << GREEN << "Telemetry applied: " << stats.lines << " fixes in " << formatSeconds(stats.seconds)
+              << " (" << (long long)stats.getFixesPerSecond() << " fixes/s)" << RESET << "\n";
+    std::cout << "  Moved:            " << stats.moved << "\n";
+    std::cout << "  Unchanged:        " << stats.unchanged << "\n";
+    std::cout << "  Stale (skipped):  " << stats.stale << "\n";
+    std::cout << "  Unknown vehicle:  " << stats.unknownVehicle << "\n";
+    std::cout << "  Unknown node:     " << stats.invalidNode << "\n";
+    std::cout << "  Malformed lines:  " << stats.malformed << "\n";
+    std::cout << "  Batches:          " << stats.batches << " (peak queue " << stats.peakQueueDepth
+              << ", reader waited " << stats.backpressureWaits << " times)\n";
+    return true;
+}
+
 // EXTRACTED from NetworkController::handleGenerateSeed
 bool FileService::generateNetworkSeed(const std::string& filename) {
     std::string sanitized = sanitizeFilename(filename);
@@ -105,11 +246,13 @@ bool FileService::generateNetworkSeed(const std::string& filename) {
     file << "N;3;Glorieta_Norte\n";
     file << "N;4;Estadio_Victoria\n";
     file << "N;5;Expo_Plaza\n";
-    file << "\n# EDGES (source;destination;weight)\n";
+    file << "\n# SPEED PROFILES (id;minute:kmh,...)\n";
+    file << "P;0;0:60,420:25,570:50,1020:20,1200:55\n";
+    file << "\n# EDGES (source;destination;weight[;profile])\n";
     file << "E;0;1;3.5\n";
-    file << "E;1;2;2.8\n";
+    file << "E;1;2;2.8;0\n";
     file << "E;0;2;6.2\n";
-    file << "E;2;3;4.1\n";
+    file << "E;2;3;4.1;0\n";
     file << "E;1;3;5.0\n";
     file << "E;3;4;3.2\n";
     file << "E;4;0;7.5\n";
@@ -160,3 +303,73 @@ bool FileService::isValidFilename(const std::string& filename) {
     std::string sanitized = sanitizeFilename(filename);
     return !sanitized.empty();
 }
+
+bool FileService::generateSyntheticNetwork(const std::string& filename, const NetworkSpec& spec) {
+    std::string sanitized = sanitizeFilename(filename);
+    if (sanitized.empty()) {
+        std::cout << RED << "Error: Invalid filename!" << RESET << "\n";
+        return false;
+    }
+
+    std::string fullPath = getDataPath(sanitized);
+    std::cout << "Generating network file: " << fullPath << "\n\n";
+
+    GeneratorService generator;
+    GeneratorStats stats;
+    if (!generator.generateNetwork(fullPath, spec, stats)) {
+        std::cout << RED << "Error: Could not write network file!" << RESET << "\n";
+        return false;
+    }
+
+    std::cout << GREEN << "Network generated: " << stats.nodes << " nodes, " << stats.edges << " edges in "
+              << formatSeconds(stats.seconds) << RESET << "\n";
+    std::cout << "You can now load it using 'Load Network' option.\n";
+    return true;
+}
+
+bool FileService::generateSyntheticFleet(const std::string& filename, int vehicleCount, int nodeCount, unsigned seed) {
+    std::string sanitized = sanitizeFilename(filename);
+    if (sanitized.empty()) {
+        std::cout << RED << "Error: Invalid filename!" << RESET << "\n";
+        return false;
+    }
+
+    std::string fullPath = getDataPath(sanitized);
+    std::cout << "Generating vehicle file: " << fullPath << "\n\n";
+
+    GeneratorService generator;
+    GeneratorStats stats;
+    if (!generator.generateFleet(fullPath, vehicleCount, nodeCount, seed, stats)) {
+        std::cout << RED << "Error: Could not write vehicle file!" << RESET << "\n";
+        return false;
+    }
+
+    std::cout << GREEN << "Fleet generated: " << stats.vehicles << " vehicles in "
+              << formatSeconds(stats.seconds) << RESET << "\n";
+    std::cout << "You can now load it using 'Load Vehicles' option.\n";
+    return true;
+}
+
+bool FileService::generateTelemetryReplay(const std::string& filename, long long updateCount, int vehicleCount,
+                                          int nodeCount, unsigned seed) {
+    std::string sanitized = sanitizeFilename(filename);
+    if (sanitized.empty()) {
+        std::cout << RED << "Error: Invalid filename!" << RESET << "\n";
+        return false;
+    }
+
+    std::string fullPath = getDataPath(sanitized);
+    std::cout << "Generating telemetry file: " << fullPath << "\n\n";
+
+    GeneratorService generator;
+    GeneratorStats stats;
+    if (!generator.generateTelemetry(fullPath, updateCount, vehicleCount, nodeCount, seed, stats)) {
+        std::cout << RED << "Error: Could not write telemetry file!" << RESET << "\n";
+        return false;
+    }
+
+    std::cout << GREEN << "Telemetry generated: " << stats.updates << " position fixes in "
+              << formatSeconds(stats.seconds) << RESET << "\n";
+    std::cout << "You can now replay it using 'Ingest Telemetry File' option.\n";
+    return true;
+}
@@ -4,6 +4,10 @@
 #include <string>
 #include "models/Graph.h"
 #include "models/HashTable.h"
+#include "Algorithms.h"
+#include "DistrictMatrix.h"
+#include "GeneratorService.h"
+#include "IngestService.h"
 
 // Reusable file service - extracts ALL file operations
 class FileService {
@@ -13,19 +17,40 @@ public:
     // EXTRACTED: Network file operations
     bool loadNetwork(const std::string& filename, Graph& network);
     bool saveNetwork(const std::string& filename, Graph& network);
+    bool applyWeightUpdates(const std::string& filename, Graph& network);
+    bool exportServiceAreas(const std::string& filename, const Graph& network,
+                            const std::vector<ServiceArea>& areas, double budget);
+
+    // Latency summary and raw histogram buckets of every instrumented operation
+    bool exportPerformanceStats(const std::string& filename);
+
+    // District all-pairs matrix (binary)
+    bool saveDistrictMatrix(const std::string& filename, const DistrictMatrix& matrix);
+    bool loadDistrictMatrix(const std::string& filename, DistrictMatrix& matrix, const Graph& network);
 
     // EXTRACTED: Vehicle file operations
     bool loadVehicles(const std::string& filename, HashTable& registry);
     bool saveVehicles(const std::string& filename, HashTable& registry);
 
+    // Telemetry replay from data/ (a regular file or a named pipe)
+    bool ingestTelemetry(const std::string& filename, HashTable& registry, const Graph& network,
+                         const IngestOptions& options = IngestOptions());
+
     // EXTRACTED: Seed generation
     bool generateNetworkSeed(const std::string& filename);
     bool generateVehicleSeed(const std::string& filename);
 
+    // Synthetic load-test inputs, written to data/ so they load directly
+    bool generateSyntheticNetwork(const std::string& filename, const NetworkSpec& spec);
+    bool generateSyntheticFleet(const std::string& filename, int vehicleCount, int nodeCount, unsigned seed);
+    bool generateTelemetryReplay(const std::string& filename, long long updateCount, int vehicleCount,
+                                 int nodeCount, unsigned seed);
+
     // EXTRACTED: Path utilities
     std::string sanitizeFilename(const std::string& filename);
     std::string getDataPath(const std::string& filename);
     std::string getSeedPath(const std::string& filename);
+    std::string getMatrixPath(const std::string& filename);
 
     // File validation
     bool fileExists(const std::string& path);
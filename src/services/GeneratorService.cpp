@@ -0,0 +1,384 @@
+#include "GeneratorService.h"
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <random>
+#include <string_view>
+#include <vector>
+
+namespace {
+    const double BLOCK_KM = 0.5;          // Grid spacing, and mean point spacing of geometric networks
+    const double DETOUR = 0.25;           // Road length exceeds straight-line distance by up to this fraction
+    const size_t WRITE_BUFFER = 1 << 20;
+    const int POINTS_PER_CELL = 16;       // Geometric layout, see GeometricLayout
+
+    // Salts keep the random streams of different attributes independent
+    enum Salt { JITTER_X = 1, JITTER_Y, ROAD_LENGTH, PLATE, VEHICLE_TYPE, ORIGIN, DESTINATION,
+                FIX_VEHICLE, FIX_NODE };
+    const long long TELEMETRY_EPOCH_MS = 1700000000000LL;  // Replay start time
+
+    // SplitMix64 finalizer. Values are a pure function of (seed, key, salt),
+    // so each streaming pass recomputes them instead of storing them.
+    unsigned long long mix(unsigned long long value) {
+        value += 0x9E3779B97F4A7C15ULL;
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+        return value ^ (value >> 31);
+    }
+
+    double unitRandom(unsigned seed, long long key, int salt) {
+        unsigned long long bits = mix(mix(((unsigned long long)seed << 8) ^ (unsigned long long)salt) ^ (unsigned long long)key);
+        return (bits >> 11) * (1.0 / 9007199254740992.0);  // [0, 1) with 53 bits
+    }
+
+    // Buffered line output. Numbers go through std::to_chars, which is
+    // several times faster than stream formatting at millions of lines.
+    class LineWriter {
+    private:
+        std::vector<char> buffer;
+        size_t used;
+        std::ofstream file;
+
+        void reserve(size_t bytes) {
+            if (used + bytes > buffer.size()) flush();
+        }
+
+    public:
+        explicit LineWriter(const std::string& path) : buffer(WRITE_BUFFER), used(0), file(path, std::ios::binary) {}
+        ~LineWriter() { flush(); }
+
+        bool isOpen() const { return file.is_open(); }
+        bool good() const { return file.good(); }
+
+        void flush() {
+            file.write(buffer.data(), (std::streamsize)used);
+            used = 0;
+        }
+
+        LineWriter& text(std::string_view value) {
+            reserve(value.size());
+            if (value.size() > buffer.size()) {
+                file.write(value.data(), (std::streamsize)value.size());
+                return *this;
+            }
+            std::copy(value.begin(), value.end(), buffer.data() + used);
+            used += value.size();
+            return *this;
+        }
+
+        LineWriter& number(long long value) {
+            reserve(24);
+            used = std::to_chars(buffer.data() + used, buffer.data() + buffer.size(), value).ptr - buffer.data();
+            return *this;
+        }
+
+        LineWriter& decimal(double value) {  // Three decimals (metres when the unit is km)
+            reserve(32);
+            used = std::to_chars(buffer.data() + used, buffer.data() + buffer.size(), value,
+                                 std::chars_format::fixed, 3).ptr - buffer.data();
+            return *this;
+        }
+    };
+
+    void writeNodes(LineWriter& writer, int nodeCount) {
+        writer.text("# NODES\n");
+        for (int id = 0; id < nodeCount; id++) {
+            writer.text("N;").number(id).text(";Node_").number(id).text("\n");
+        }
+    }
+
+    void writeRoad(LineWriter& writer, int a, int b, double straightKm, unsigned seed, GeneratorStats& stats) {
+        long long key = (long long)std::min(a, b) * 2147483647LL + std::max(a, b);
+        double length = std::max(0.05, straightKm * (1.0 + DETOUR * unitRandom(seed, key, ROAD_LENGTH)));
+        writer.text("E;").number(a).text(";").number(b).text(";").decimal(length).text("\n");
+        writer.text("E;").number(b).text(";").number(a).text(";").decimal(length).text("\n");
+        stats.edges += 2;
+    }
+
+    // ----- Grid -----
+
+    void gridPosition(int id, int side, unsigned seed, double& x, double& y) {
+        x = (id % side + (unitRandom(seed, id, JITTER_X) - 0.5) * 0.3) * BLOCK_KM;
+        y = (id / side + (unitRandom(seed, id, JITTER_Y) - 0.5) * 0.3) * BLOCK_KM;
+    }
+
+    void generateGrid(LineWriter& writer, const NetworkSpec& spec, GeneratorStats& stats) {
+        int nodeCount = spec.nodeCount;
+        int side = (int)std::ceil(std::sqrt((double)nodeCount));
+
+        writer.text("\n# COORDINATES (id;x;y)\n");
+        for (int id = 0; id < nodeCount; id++) {
+            double x, y;
+            gridPosition(id, side, spec.seed, x, y);
+            writer.text("C;").number(id).text(";").decimal(x).text(";").decimal(y).text("\n");
+        }
+
+        writer.text("\n# EDGES (source;destination;weight[;profile])\n");
+        for (int id = 0; id < nodeCount; id++) {
+            double x, y;
+            gridPosition(id, side, spec.seed, x, y);
+
+            int neighbours[2] = {(id + 1) % side != 0 ? id + 1 : -1, id + side};
+            for (int other : neighbours) {
+                if (other == -1 || other >= nodeCount) continue;
+                double ox, oy;
+                gridPosition(other, side, spec.seed, ox, oy);
+                writeRoad(writer, id, other, std::hypot(ox - x, oy - y), spec.seed, stats);
+            }
+        }
+    }
+
+    // ----- Random geometric -----
+
+    // Nodes are numbered cell by cell (row-major), an equal share per cell,
+    // and placed uniformly inside their cell. Cells are at least one link
+    // radius wide, so candidate pairs are in the same or an adjacent cell,
+    // and hold enough points that the even share per cell does not thin
+    // out short links.
+    struct GeometricLayout {
+        int nodeCount;
+        int cellsPerSide;
+        double cellSize;
+        double radius;
+        unsigned seed;
+
+        int cellCount() const { return cellsPerSide * cellsPerSide; }
+        int firstNode(int cell) const { return (int)((long long)cell * nodeCount / cellCount()); }
+
+        void position(int id, int cell, double& x, double& y) const {
+            x = (cell % cellsPerSide + unitRandom(seed, id, JITTER_X)) * cellSize;
+            y = (cell / cellsPerSide + unitRandom(seed, id, JITTER_Y)) * cellSize;
+        }
+    };
+
+    GeometricLayout geometricLayout(const NetworkSpec& spec) {
+        GeometricLayout layout;
+        layout.nodeCount = spec.nodeCount;
+        layout.seed = spec.seed;
+
+        // Expected degree = density * pi * r^2, with density 1 / BLOCK_KM^2
+        double extent = std::sqrt((double)spec.nodeCount) * BLOCK_KM;
+        layout.radius = BLOCK_KM * std::sqrt(spec.averageDegree / 3.14159265358979);
+        double minCell = std::max(layout.radius, std::sqrt((double)POINTS_PER_CELL) * BLOCK_KM);
+        layout.cellsPerSide = std::max(1, (int)(extent / minCell));
+        layout.cellSize = extent / layout.cellsPerSide;
+        return layout;
+    }
+
+    // Positions of one row of cells, so the pair scan computes each position once
+    struct CellRow {
+        int firstId;
+        std::vector<double> x;
+        std::vector<double> y;
+
+        void fill(const GeometricLayout& layout, int row) {
+            firstId = layout.firstNode(row * layout.cellsPerSide);
+            int endId = layout.firstNode((row + 1) * layout.cellsPerSide);
+            x.resize(endId - firstId);
+            y.resize(endId - firstId);
+            for (int cell = row * layout.cellsPerSide; cell < (row + 1) * layout.cellsPerSide; cell++) {
+                for (int id = layout.firstNode(cell); id < layout.firstNode(cell + 1); id++) {
+                    layout.position(id, cell, x[id - firstId], y[id - firstId]);
+                }
+            }
+        }
+    };
+
+    void generateGeometric(LineWriter& writer, const NetworkSpec& spec, GeneratorStats& stats) {
+        GeometricLayout layout = geometricLayout(spec);
+        int cellCount = layout.cellCount();
+
+        writer.text("\n# COORDINATES (id;x;y)\n");
+        for (int cell = 0; cell < cellCount; cell++) {
+            for (int id = layout.firstNode(cell); id < layout.firstNode(cell + 1); id++) {
+                double x, y;
+                layout.position(id, cell, x, y);
+                writer.text("C;").number(id).text(";").decimal(x).text(";").decimal(y).text("\n");
+            }
+        }
+
+        // Each pair is examined once: same cell (higher IDs) plus the four
+        // neighbouring cells that come later in row-major order
+        const int offsets[4][2] = {{1, 0}, {-1, 1}, {0, 1}, {1, 1}};
+        double radiusSquared = layout.radius * layout.radius;
+        CellRow rows[2];
+        rows[0].fill(layout, 0);
+
+        writer.text("\n# EDGES (source;destination;weight[;profile])\n");
+        for (int cy = 0; cy < layout.cellsPerSide; cy++) {
+            CellRow& current = rows[cy % 2];
+            CellRow& below = rows[(cy + 1) % 2];
+            if (cy + 1 < layout.cellsPerSide) below.fill(layout, cy + 1);
+
+            for (int cx = 0; cx < layout.cellsPerSide; cx++) {
+                int cell = cy * layout.cellsPerSide + cx;
+
+                for (int id = layout.firstNode(cell); id < layout.firstNode(cell + 1); id++) {
+                    double x = current.x[id - current.firstId];
+                    double y = current.y[id - current.firstId];
+
+                    auto linkWithin = [&](const CellRow& row, int otherCell, int firstOther) {
+                        for (int other = firstOther; other < layout.firstNode(otherCell + 1); other++) {
+                            double dx = row.x[other - row.firstId] - x;
+                            double dy = row.y[other - row.firstId] - y;
+                            if (dx * dx + dy * dy <= radiusSquared) {
+                                writeRoad(writer, id, other, std::sqrt(dx * dx + dy * dy), spec.seed, stats);
+                            }
+                        }
+                    };
+
+                    linkWithin(current, cell, id + 1);
+                    for (const auto& offset : offsets) {
+                        int nx = cx + offset[0];
+                        int ny = cy + offset[1];
+                        if (nx < 0 || nx >= layout.cellsPerSide || ny >= layout.cellsPerSide) continue;
+                        int otherCell = ny * layout.cellsPerSide + nx;
+                        linkWithin(ny == cy ? current : below, otherCell, layout.firstNode(otherCell));
+                    }
+                }
+            }
+        }
+    }
+
+    // ----- Scale-free -----
+
+    // Barabasi-Albert: each new node links to m distinct existing nodes,
+    // chosen proportionally to degree by sampling the endpoint list
+    void generateScaleFree(LineWriter& writer, const NetworkSpec& spec, GeneratorStats& stats) {
+        int nodeCount = spec.nodeCount;
+        int links = std::max(1, spec.averageDegree / 2);
+        int coreSize = std::min(nodeCount, links + 1);
+        std::mt19937_64 rng(spec.seed);
+
+        std::vector<int> endpoints;
+        endpoints.reserve((size_t)2 * links * nodeCount);
+
+        writer.text("\n# EDGES (source;destination;weight[;profile])\n");
+        for (int a = 0; a < coreSize; a++) {
+            for (int b = a + 1; b < coreSize; b++) {
+                writeRoad(writer, a, b, BLOCK_KM * (1.0 + 9.0 * unitRandom(spec.seed, (long long)a * nodeCount + b, JITTER_X)),
+                          spec.seed, stats);
+                endpoints.push_back(a);
+                endpoints.push_back(b);
+            }
+        }
+
+        std::vector<int> chosen;
+        for (int id = coreSize; id < nodeCount; id++) {
+            chosen.clear();
+            while ((int)chosen.size() < links) {
+                int target = endpoints.empty() ? 0 : endpoints[rng() % endpoints.size()];
+                if (std::find(chosen.begin(), chosen.end(), target) == chosen.end()) {
+                    chosen.push_back(target);
+                }
+            }
+            for (int target : chosen) {
+                double straightKm = BLOCK_KM * (1.0 + 9.0 * unitRandom(spec.seed, (long long)id * nodeCount + target, JITTER_X));
+                writeRoad(writer, id, target, straightKm, spec.seed, stats);
+                endpoints.push_back(id);
+                endpoints.push_back(target);
+            }
+        }
+    }
+}
+
+GeneratorService::GeneratorService() {}
+
+bool GeneratorService::generateNetwork(const std::string& path, const NetworkSpec& spec, GeneratorStats& stats) {
+    auto start = std::chrono::steady_clock::now();
+    stats = GeneratorStats();
+
+    LineWriter writer(path);
+    if (!writer.isOpen()) {
+        return false;
+    }
+
+    const char* shapeNames[] = {"grid", "random geometric", "scale-free"};
+    writer.text("# SYNTHETIC NETWORK - ").text(shapeNames[(int)spec.shape]).text(", ")
+          .number(spec.nodeCount).text(" nodes, seed ").number(spec.seed).text("\n");
+    writeNodes(writer, spec.nodeCount);
+    stats.nodes = spec.nodeCount;
+
+    switch (spec.shape) {
+        case NetworkShape::GRID:       generateGrid(writer, spec, stats); break;
+        case NetworkShape::GEOMETRIC:  generateGeometric(writer, spec, stats); break;
+        case NetworkShape::SCALE_FREE: generateScaleFree(writer, spec, stats); break;
+    }
+
+    writer.flush();
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return writer.good();
+}
+
+bool GeneratorService::generateFleet(const std::string& path, int vehicleCount, int nodeCount, unsigned seed,
+                                     GeneratorStats& stats) {
+    auto start = std::chrono::steady_clock::now();
+    stats = GeneratorStats();
+
+    LineWriter writer(path);
+    if (!writer.isOpen()) {
+        return false;
+    }
+
+    writer.text("# SYNTHETIC VEHICLES - ").number(vehicleCount).text(" vehicles on ")
+          .number(nodeCount).text(" nodes, seed ").number(seed).text("\n");
+    for (int id = 0; id < vehicleCount; id++) {
+        char plate[9];
+        for (int i = 0; i < 3; i++) {
+            plate[i] = (char)('A' + (int)(unitRandom(seed, id * 8LL + i, PLATE) * 26));
+        }
+        plate[3] = '-';
+        int digits = (int)(unitRandom(seed, id, PLATE) * 10000);
+        for (int i = 7; i >= 4; i--) {
+            plate[i] = (char)('0' + digits % 10);
+            digits /= 10;
+        }
+        plate[8] = '\0';
+
+        double kind = unitRandom(seed, id, VEHICLE_TYPE);
+        const char* type = kind < 0.6 ? "Sedan" : (kind < 0.85 ? "Compact" : "Truck");
+
+        int origin = (int)(unitRandom(seed, id, ORIGIN) * nodeCount);
+        int dest = nodeCount > 1
+            ? (origin + 1 + (int)(unitRandom(seed, id, DESTINATION) * (nodeCount - 1))) % nodeCount
+            : origin;
+
+        writer.text("V;").number(id).text(";").text(plate).text(";").text(type).text(";")
+              .number(origin).text(";").number(dest).text("\n");
+    }
+    stats.vehicles = vehicleCount;
+
+    writer.flush();
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return writer.good();
+}
+
+bool GeneratorService::generateTelemetry(const std::string& path, long long updateCount, int vehicleCount,
+                                         int nodeCount, unsigned seed, GeneratorStats& stats) {
+    auto start = std::chrono::steady_clock::now();
+    stats = GeneratorStats();
+
+    LineWriter writer(path);
+    if (!writer.isOpen()) {
+        return false;
+    }
+
+    // One fix per millisecond, so no two fixes share a timestamp
+    writer.text("# SYNTHETIC TELEMETRY - ").number(updateCount).text(" fixes for ").number(vehicleCount)
+          .text(" vehicles on ").number(nodeCount).text(" nodes, seed ").number(seed).text("\n");
+    writer.text("# T;vehicle;node;timestamp_ms\n");
+    for (long long i = 0; i < updateCount; i++) {
+        int vehicle = (int)(unitRandom(seed, i, FIX_VEHICLE) * vehicleCount);
+        int node = (int)(unitRandom(seed, i, FIX_NODE) * nodeCount);
+        writer.text("T;").number(vehicle).text(";").number(node).text(";")
+              .number(TELEMETRY_EPOCH_MS + i).text("\n");
+    }
+    stats.vehicles = vehicleCount;
+    stats.updates = updateCount;
+
+    writer.flush();
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return writer.good();
+}
@@ -0,0 +1,50 @@
+#ifndef GENERATORSERVICE_H
+#define GENERATORSERVICE_H
+
+#include <string>
+
+enum class NetworkShape {
+    GRID,        // Jittered street grid, two-way links to the four neighbours
+    GEOMETRIC,   // Random points, two-way links between points closer than a radius
+    SCALE_FREE   // Preferential attachment (Barabasi-Albert), a few heavy hubs
+};
+
+struct NetworkSpec {
+    NetworkShape shape;
+    int nodeCount;
+    int averageDegree;   // Target two-way links per node (geometric / scale-free)
+    unsigned seed;
+
+    NetworkSpec() : shape(NetworkShape::GRID), nodeCount(0), averageDegree(4), seed(1) {}
+};
+
+struct GeneratorStats {
+    long long nodes;
+    long long edges;     // Directed E; lines written
+    long long vehicles;
+    long long updates;   // Telemetry lines
+    double seconds;
+
+    GeneratorStats() : nodes(0), edges(0), vehicles(0), updates(0), seconds(0.0) {}
+};
+
+// Synthetic inputs for load testing, written straight to disk in the
+// network / vehicle file formats. Every random choice is derived from the
+// seed, so the same spec always yields the same file. Grid and geometric
+// networks are generated in a few streaming passes with no per-node state;
+// scale-free networks keep one int per edge endpoint for the attachment
+// sampling, never a Graph.
+class GeneratorService {
+public:
+    GeneratorService();
+
+    bool generateNetwork(const std::string& path, const NetworkSpec& spec, GeneratorStats& stats);
+    // Vehicle IDs 0..vehicleCount-1 placed on node IDs 0..nodeCount-1
+    bool generateFleet(const std::string& path, int vehicleCount, int nodeCount, unsigned seed,
+                       GeneratorStats& stats);
+    // Telemetry replay (T;vehicle;node;timestamp_ms), timestamps ascending
+    bool generateTelemetry(const std::string& path, long long updateCount, int vehicleCount, int nodeCount,
+                           unsigned seed, GeneratorStats& stats);
+};
+
+#endif
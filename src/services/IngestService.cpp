@@ -0,0 +1,169 @@
+#include "IngestService.h"
+#include "BoundedQueue.h"
+#include "Metrics.h"
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+    // Parses "T;vehicle;node;timestamp" from [begin, end), a line without its newline.
+    // IDs are never negative; from_chars would accept a sign, so it is rejected here.
+    bool parseFix(const char* begin, const char* end, int& vehicleId, int& nodeId, long long& timestamp) {
+        if (end - begin < 2 || begin[0] != 'T' || begin[1] != ';') {
+            return false;
+        }
+
+        const char* p = begin + 2;
+        auto field = [&](auto& value, bool last) {
+            auto [next, error] = std::from_chars(p, end, value);
+            if (error != std::errc() || (!last && (next == end || *next != ';'))) {
+                return false;
+            }
+            p = last ? next : next + 1;
+            return true;
+        };
+        if (!field(vehicleId, false) || !field(nodeId, false) || !field(timestamp, true)) {
+            return false;
+        }
+        return p == end && vehicleId >= 0 && nodeId >= 0;
+    }
+
+    // Applies every line of one batch; counts go to the worker's own stats
+    void applyBatch(const std::string& batch, HashTable& registry, const Graph& network, bool logMovements,
+                    IngestStats& local, std::vector<Movement>& movements) {
+        ScopedTimer timer(Operation::TELEMETRY_BATCH);
+        movements.clear();
+
+        const char* p = batch.data();
+        const char* end = p + batch.size();
+        while (p < end) {
+            const char* lineEnd = std::find(p, end, '\n');
+            const char* next = lineEnd < end ? lineEnd + 1 : end;
+            if (lineEnd > p && lineEnd[-1] == '\r') lineEnd--;
+
+            if (lineEnd == p || *p == '#') {
+                p = next;
+                continue;
+            }
+
+            local.lines++;
+            int vehicleId;
+            int nodeId;
+            long long timestamp;
+            if (!parseFix(p, lineEnd, vehicleId, nodeId, timestamp)) {
+                local.malformed++;
+            } else if (!network.nodeExists(nodeId)) {
+                local.invalidNode++;
+            } else {
+                switch (registry.applyPositionFix(vehicleId, nodeId, timestamp)) {
+                    case PositionFix::MOVED:
+                        local.moved++;
+                        if (logMovements) {
+                            Movement movement;
+                            movement.vehicleId = vehicleId;
+                            movement.destinationNodeId = nodeId;
+                            movement.status = "telemetry";
+                            movements.push_back(movement);
+                        }
+                        break;
+                    case PositionFix::UNCHANGED:       local.unchanged++; break;
+                    case PositionFix::STALE:           local.stale++; break;
+                    case PositionFix::UNKNOWN_VEHICLE: local.unknownVehicle++; break;
+                }
+            }
+            p = next;
+        }
+
+        registry.logMovements(movements);
+    }
+}
+
+IngestService::IngestService() {}
+
+bool IngestService::ingestFile(const std::string& path, HashTable& registry, const Graph& network,
+                               const IngestOptions& options, IngestStats& stats) {
+    auto start = std::chrono::steady_clock::now();
+    stats = IngestStats();
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    int workerCount = options.workerCount;
+    if (workerCount <= 0) {
+        workerCount = std::max(1, (int)std::thread::hardware_concurrency() - 1);
+    }
+    size_t batchBytes = std::max<size_t>(options.batchBytes, 4096);
+
+    BoundedQueue<std::string> queue(options.queueCapacity);
+    std::mutex statsMutex;
+    auto worker = [&]() {
+        IngestStats local;
+        std::vector<Movement> movements;
+        std::string batch;
+        while (queue.pop(batch)) {
+            applyBatch(batch, registry, network, options.logMovements, local, movements);
+            local.batches++;
+        }
+
+        std::lock_guard<std::mutex> lock(statsMutex);
+        stats.lines += local.lines;
+        stats.moved += local.moved;
+        stats.unchanged += local.unchanged;
+        stats.stale += local.stale;
+        stats.unknownVehicle += local.unknownVehicle;
+        stats.invalidNode += local.invalidNode;
+        stats.malformed += local.malformed;
+        stats.batches += local.batches;
+    };
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < workerCount; t++) {
+        workers.emplace_back(worker);
+    }
+
+    // Each block is cut after its last newline; the partial line left over
+    // starts the next block, so no line is ever split between workers
+    std::string carry;
+    long long bytes = 0;
+    while (file) {
+        std::string block = std::move(carry);
+        carry.clear();
+        size_t kept = block.size();
+        block.resize(kept + batchBytes);
+        file.read(block.data() + kept, (std::streamsize)batchBytes);
+        size_t got = (size_t)file.gcount();
+        block.resize(kept + got);
+        bytes += (long long)got;
+
+        size_t cut = block.rfind('\n');
+        if (file && cut != std::string::npos && cut + 1 < block.size()) {
+            carry.assign(block, cut + 1, std::string::npos);
+            block.resize(cut + 1);
+        } else if (file && cut == std::string::npos) {
+            carry = std::move(block);  // One line longer than a block; keep reading
+            continue;
+        }
+
+        if (!block.empty()) {
+            queue.push(std::move(block));
+        }
+    }
+    bool readError = file.bad();
+
+    queue.close();
+    for (std::thread& thread : workers) {
+        thread.join();
+    }
+
+    stats.bytes = bytes;
+    stats.backpressureWaits = (long long)queue.getFullWaits();
+    stats.peakQueueDepth = (long long)queue.getPeakDepth();
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return !readError;
+}
@@ -0,0 +1,53 @@
+#ifndef INGESTSERVICE_H
+#define INGESTSERVICE_H
+
+#include <string>
+#include "models/Graph.h"
+#include "models/HashTable.h"
+
+struct IngestOptions {
+    int workerCount;        // Parsing threads; 0 = one per core beside the reader
+    size_t batchBytes;      // Input is cut into batches of about this size, on line breaks
+    size_t queueCapacity;   // Batches read ahead of the workers before the reader waits
+    bool logMovements;      // Append moved vehicles to the movement log
+
+    IngestOptions() : workerCount(0), batchBytes(256 * 1024), queueCapacity(16), logMovements(true) {}
+};
+
+struct IngestStats {
+    long long bytes;
+    long long lines;            // Fix lines, comments and blanks excluded
+    long long moved;
+    long long unchanged;
+    long long stale;            // Older than a fix already applied
+    long long unknownVehicle;
+    long long invalidNode;
+    long long malformed;
+    long long batches;
+    long long backpressureWaits;  // Times the reader found the queue full
+    long long peakQueueDepth;
+    double seconds;
+
+    IngestStats() : bytes(0), lines(0), moved(0), unchanged(0), stale(0), unknownVehicle(0), invalidNode(0),
+                    malformed(0), batches(0), backpressureWaits(0), peakQueueDepth(0), seconds(0.0) {}
+
+    double getFixesPerSecond() const { return seconds > 0.0 ? lines / seconds : 0.0; }
+};
+
+// Applies a telemetry replay (T;vehicle;node;timestamp_ms lines, '#'
+// comments) to the registry. The calling thread reads the input in large
+// blocks cut on line breaks and hands them to worker threads through a
+// bounded queue, so a slow registry holds the reader back instead of the
+// input piling up in memory. Workers parse with std::from_chars and apply
+// each fix under the vehicle's stripe lock; batches may finish in any
+// order, and the per-vehicle timestamp check makes the newest fix win
+// regardless. Works the same on a regular file or a named pipe.
+class IngestService {
+public:
+    IngestService();
+
+    bool ingestFile(const std::string& path, HashTable& registry, const Graph& network,
+                    const IngestOptions& options, IngestStats& stats);
+};
+
+#endif
@@ -4,6 +4,7 @@
 #include "utils/colors.h"
 #include <iostream>
 #include <iomanip>
+#include <vector>
 #include <conio.h>
 
 SelectionService::SelectionService() {}
@@ -18,13 +19,24 @@ int SelectionService::selectNode(const Graph& network, const std::string& title)
     InteractivePaginatedTable table(title, "Name", "Connections");
     const Node* nodes = network.getNodes();
 
+    // Only slot indices are collected; rows are built per visible page
+    std::vector<int> slots;
+    slots.reserve(network.getNodeCount());
     for (int i = 0; i < network.getMaxNodes(); i++) {
         if (nodes[i].active) {
-            int connCount = network.getConnectionCount(nodes[i].id);
-            table.addRow(nodes[i].id, nodes[i].name, std::to_string(connCount) + " edges");
+            slots.push_back(i);
         }
     }
 
+    table.setDataSource((int)slots.size(),
+        [&](int row) {
+            const Node& node = nodes[slots[row]];
+            int connCount = network.getConnectionCount(node.id);
+            return TableRow{node.id, node.name, std::to_string(connCount) + " edges", ""};
+        },
+        [&](int id) { return network.nodeExists(id); });
+    table.enableSearch([&](int row) { return nodes[slots[row]].name; });
+
     return table.run();
 }
 
@@ -39,15 +51,25 @@ int SelectionService::selectVehicle(const HashTable& registry, const Graph& netw
     InteractivePaginatedTable table(title, "Plate", "Type", "Location");
     const Vehicle* vehicles = registry.getVehicles();
 
+    std::vector<int> slots;
+    slots.reserve(registry.getVehicleCount());
     for (int i = 0; i < registry.getHashSize(); i++) {
         if (vehicles[i].active) {
-            std::string location = network.nodeExists(vehicles[i].currentNodeId)
-                ? network.getNodeName(vehicles[i].currentNodeId)
-                : "Unknown";
-            table.addRow(vehicles[i].id, vehicles[i].plate, vehicles[i].type, location);
+            slots.push_back(i);
         }
     }
 
+    table.setDataSource((int)slots.size(),
+        [&](int row) {
+            const Vehicle& vehicle = vehicles[slots[row]];
+            std::string location = network.nodeExists(vehicle.currentNodeId)
+                ? network.getNodeName(vehicle.currentNodeId)
+                : "Unknown";
+            return TableRow{vehicle.id, vehicle.plate, vehicle.type, location};
+        },
+        [&](int id) { return registry.vehicleExists(id); });
+    table.enableSearch([&](int row) { return vehicles[slots[row]].plate; });
+
     return table.run();
 }
 
@@ -1,8 +1,64 @@
 #include "NetworkView.h"
+#include "DfsEngine.h"
+#include "ComponentIndex.h"
 #include <iomanip>
+#include <algorithm>
+#include <cstdio>
 
 NetworkView::NetworkView() {}
 
+bool AdjacencyFilter::matches(const Node& node) const {
+    if (minId != -1 && node.id < minId) return false;
+    if (maxId != -1 && node.id > maxId) return false;
+    if (!namePrefix.empty() && node.name.compare(0, namePrefix.size(), namePrefix) != 0) {
+        return false;
+    }
+    return true;
+}
+
+NetworkView::NameIndex NetworkView::buildNameIndex(const Graph& network) const {
+    NameIndex names;
+    names.reserve(network.getNodeCount());
+
+    const Node* nodes = network.getNodes();
+    for (int i = 0; i < network.getMaxNodes(); i++) {
+        if (nodes[i].active) {
+            names[nodes[i].id] = &nodes[i].name;
+        }
+    }
+    return names;
+}
+
+void NetworkView::appendAdjacencyLine(std::string& out, const Node& node, const NameIndex& names) const {
+    char weightBuf[32];
+
+    out += "[";
+    out += std::to_string(node.id);
+    out += "] ";
+    out += node.name;
+    out += " -> ";
+
+    Edge* current = node.adjacencyList;
+    if (current == nullptr) {
+        out += "(no connections)";
+    }
+    while (current != nullptr) {
+        auto it = names.find(current->destination);
+        if (it != names.end()) {
+            out += *it->second;
+        }
+        std::snprintf(weightBuf, sizeof(weightBuf), "%g", current->weight);
+        out += "(";
+        out += weightBuf;
+        out += ")";
+        if (current->next != nullptr) {
+            out += ", ";
+        }
+        current = current->next;
+    }
+    out += "\n";
+}
+
 void NetworkView::showAdjacencyList(const Graph& network) {
     if (network.getNodeCount() == 0) {
         showError("Network is empty!");
@@ -11,35 +67,81 @@ void NetworkView::showAdjacencyList(const Graph& network) {
 
     showTitle("Adjacency list");
 
+    NameIndex names = buildNameIndex(network);
+    std::string out;
+
     const Node* nodes = network.getNodes();
     for (int i = 0; i < network.getMaxNodes(); i++) {
         if (nodes[i].active) {
-            std::cout << "[" << nodes[i].id << "] " << nodes[i].name << " -> ";
-
-            Edge* current = nodes[i].adjacencyList;
-            if (current == nullptr) {
-                std::cout << "(no connections)";
-            } else {
-                while (current != nullptr) {
-                    // Find destination node name
-                    std::string destName = "";
-                    for (int j = 0; j < network.getMaxNodes(); j++) {
-                        if (nodes[j].active && nodes[j].id == current->destination) {
-                            destName = nodes[j].name;
-                            break;
-                        }
-                    }
-                    std::cout << destName << "(" << current->weight << ")";
-                    if (current->next != nullptr) {
-                        std::cout << ", ";
-                    }
-                    current = current->next;
-                }
+            appendAdjacencyLine(out, nodes[i], names);
+        }
+    }
+    out += "\n";
+
+    // Single flush instead of one stream write per edge
+    std::cout.write(out.data(), out.size());
+}
+
+void NetworkView::showAdjacencyList(const Graph& network, const AdjacencyFilter& filter, int pageSize) {
+    if (network.getNodeCount() == 0) {
+        showError("Network is empty!");
+        return;
+    }
+
+    // Collect matching slots once, then page over them
+    std::vector<int> matches;
+    const Node* nodes = network.getNodes();
+    for (int i = 0; i < network.getMaxNodes(); i++) {
+        if (nodes[i].active && filter.matches(nodes[i])) {
+            matches.push_back(i);
+        }
+    }
+
+    if (matches.empty()) {
+        showError("No nodes match the filter!");
+        return;
+    }
+
+    if (pageSize <= 0) pageSize = (int)matches.size();
+
+    NameIndex names = buildNameIndex(network);
+    int totalPages = ((int)matches.size() + pageSize - 1) / pageSize;
+    int currentPage = 0;
+    std::string out;
+
+    while (true) {
+        int startIdx = currentPage * pageSize;
+        int endIdx = std::min(startIdx + pageSize, (int)matches.size());
+
+        out.clear();
+        for (int i = startIdx; i < endIdx; i++) {
+            appendAdjacencyLine(out, nodes[matches[i]], names);
+        }
+
+        system("cls");
+        showTitle("Adjacency list (filtered)");
+        std::cout.write(out.data(), out.size());
+        std::cout << "\nPage " << (currentPage + 1) << " of " << totalPages
+                  << " | Matching nodes: " << matches.size() << "\n";
+        std::cout << "[A/D or Left/Right] Change Page | [ESC] Back\n";
+
+        int ch = _getch();
+
+        if (ch == 224 || ch == 0) {
+            ch = _getch();
+            if ((ch == 75 || ch == 'K') && currentPage > 0) { // Left
+                currentPage--;
+            } else if ((ch == 77 || ch == 'M') && currentPage < totalPages - 1) { // Right
+                currentPage++;
             }
-            std::cout << "\n";
+        } else if ((ch == 'a' || ch == 'A') && currentPage > 0) {
+            currentPage--;
+        } else if ((ch == 'd' || ch == 'D') && currentPage < totalPages - 1) {
+            currentPage++;
+        } else if (ch == 27 || ch == 13) { // ESC or Enter
+            return;
         }
     }
-    std::cout << "\n";
 }
 
 void NetworkView::showAdjacencyMatrix(const Graph& network) {
@@ -91,6 +193,135 @@ void NetworkView::showAdjacencyMatrix(const Graph& network) {
     std::cout << "\n";
 }
 
+void NetworkView::showDegreeReport(const Graph& network) {
+    if (network.getNodeCount() == 0) {
+        showError("Network is empty!");
+        return;
+    }
+
+    showTitle("Network degree report");
+
+    int isolated = 0;
+    int sources = 0;  // Only outgoing roads
+    int sinks = 0;    // Only incoming roads (dead ends)
+    int edgeCount = 0;
+
+    const Node* nodes = network.getNodes();
+    for (int i = 0; i < network.getMaxNodes(); i++) {
+        if (nodes[i].active) {
+            edgeCount += nodes[i].outDegree;
+            if (nodes[i].inDegree == 0 && nodes[i].outDegree == 0) {
+                isolated++;
+            } else if (nodes[i].inDegree == 0) {
+                sources++;
+            } else if (nodes[i].outDegree == 0) {
+                sinks++;
+            }
+        }
+    }
+
+    std::cout << std::setw(25) << "Metric" << " | " << std::setw(15) << "Value" << "\n";
+    std::cout << std::string(45, '-') << "\n";
+    std::cout << std::setw(25) << "Nodes" << " | " << std::setw(15) << network.getNodeCount() << "\n";
+    std::cout << std::setw(25) << "Edges" << " | " << std::setw(15) << edgeCount << "\n";
+    std::cout << std::setw(25) << "Average out-degree" << " | " << std::setw(15)
+              << std::fixed << std::setprecision(2)
+              << (double)edgeCount / network.getNodeCount() << "\n";
+    std::cout << std::setw(25) << "Isolated nodes" << " | " << std::setw(15) << isolated << "\n";
+    std::cout << std::setw(25) << "Source-only nodes" << " | " << std::setw(15) << sources << "\n";
+    std::cout << std::setw(25) << "Dead-end nodes" << " | " << std::setw(15) << sinks << "\n";
+
+    std::map<int, int> outHistogram = network.getDegreeHistogram(false);
+    std::map<int, int> inHistogram = network.getDegreeHistogram(true);
+
+    // Merge both histograms into one table keyed by degree
+    std::map<int, std::pair<int, int>> merged;
+    for (const auto& [degree, count] : outHistogram) merged[degree].first = count;
+    for (const auto& [degree, count] : inHistogram) merged[degree].second = count;
+
+    std::cout << "\nDegree histogram:\n";
+    std::cout << std::setw(8) << "Degree" << " | "
+              << std::setw(12) << "Out (nodes)" << " | "
+              << std::setw(12) << "In (nodes)" << "\n";
+    std::cout << std::string(38, '-') << "\n";
+    for (const auto& [degree, counts] : merged) {
+        std::cout << std::setw(8) << degree << " | "
+                  << std::setw(12) << counts.first << " | "
+                  << std::setw(12) << counts.second << "\n";
+    }
+    std::cout << "\n";
+}
+
+void NetworkView::showStructureReport(const Graph& network) {
+    if (network.getNodeCount() == 0) {
+        showError("Network is empty!");
+        return;
+    }
+
+    showTitle("Network structure report");
+
+    RoutingSnapshot snapshot(network);
+    DfsEngine engine(snapshot);
+    engine.runAll();
+
+    std::cout << std::setw(25) << "Metric" << " | " << std::setw(15) << "Value" << "\n";
+    std::cout << std::string(45, '-') << "\n";
+    std::cout << std::setw(25) << "DFS trees" << " | " << std::setw(15) << engine.getTreeCount() << "\n";
+    std::cout << std::setw(25) << "Back edges" << " | " << std::setw(15) << engine.getBackEdgeCount() << "\n";
+    std::cout << std::setw(25) << "Contains cycles" << " | " << std::setw(15)
+              << (engine.hasCycle() ? "Yes" : "No") << "\n";
+
+    ComponentIndex components;
+    components.refresh(network);
+    int largest = components.getLargestStrong();
+    std::vector<int> traps = components.trapComponents();
+    std::vector<int> unreachable = components.unreachableComponents();
+
+    std::cout << std::setw(25) << "Strong components" << " | " << std::setw(15) << components.getStrongCount() << "\n";
+    std::cout << std::setw(25) << "Largest strong comp." << " | " << std::setw(15)
+              << components.getStrongSize(largest) << "\n";
+    std::cout << std::setw(25) << "Disconnected parts" << " | " << std::setw(15) << components.getWeakCount() << "\n";
+    std::cout << std::setw(25) << "One-way dead ends" << " | " << std::setw(15) << traps.size() << "\n";
+    std::cout << std::setw(25) << "Unreachable areas" << " | " << std::setw(15) << unreachable.size() << "\n";
+
+    // Listings are capped so large networks stay readable
+    auto listComponents = [&](const char* heading, const std::vector<int>& list) {
+        if (list.empty()) return;
+        const int maxComponents = 10;
+        const int maxNodes = 8;
+        std::cout << "\n" << YELLOW << heading << RESET << "\n";
+        for (int i = 0; i < (int)list.size() && i < maxComponents; i++) {
+            std::vector<int> ids = components.nodesIn(list[i]);
+            std::cout << "  -";
+            for (int j = 0; j < (int)ids.size() && j < maxNodes; j++) {
+                std::cout << " [" << ids[j] << "] " << network.getNodeName(ids[j]);
+            }
+            if ((int)ids.size() > maxNodes) std::cout << " ... (" << ids.size() - maxNodes << " more)";
+            std::cout << "\n";
+        }
+        if ((int)list.size() > maxComponents) {
+            std::cout << "  ... (" << list.size() - maxComponents << " more)\n";
+        }
+    };
+    listComponents("One-way dead ends (no way back out):", traps);
+    listComponents("Areas with no way in:", unreachable);
+
+    std::vector<int> order = engine.topologicalOrder();
+    if (!order.empty()) {
+        const int preview = 15;
+        std::cout << "\nTopological order:\n";
+        for (int i = 0; i < (int)order.size() && i < preview; i++) {
+            std::cout << "[" << snapshot.nodeIds[order[i]] << "]";
+            if (i < (int)order.size() - 1) std::cout << " -> ";
+        }
+        if ((int)order.size() > preview) {
+            std::cout << "... (" << order.size() - preview << " more)";
+        }
+        std::cout << "\n";
+    }
+    std::cout << "\n";
+}
+
 void NetworkView::showNodeDetails(const Node& node) {
     std::cout << "Node ID: " << node.id << "\n";
     std::cout << "Name: " << node.name << "\n";
@@ -4,13 +4,36 @@
 #include "BaseView.h"
 #include "models/Graph.h"
 #include <string>
+#include <vector>
+#include <unordered_map>
+
+// Filter for partial adjacency list dumps (default = whole network)
+struct AdjacencyFilter {
+    int minId;
+    int maxId;
+    std::string namePrefix;
+
+    AdjacencyFilter() : minId(-1), maxId(-1), namePrefix("") {}
+
+    bool matches(const Node& node) const;
+};
 
 class NetworkView : public BaseView {
+private:
+    typedef std::unordered_map<int, const std::string*> NameIndex;
+
+    // Built once per render so each edge resolves its destination in O(1)
+    NameIndex buildNameIndex(const Graph& network) const;
+    void appendAdjacencyLine(std::string& out, const Node& node, const NameIndex& names) const;
+
 public:
     NetworkView();
 
     void showAdjacencyList(const Graph& network);
+    void showAdjacencyList(const Graph& network, const AdjacencyFilter& filter, int pageSize = 20);
     void showAdjacencyMatrix(const Graph& network);
+    void showDegreeReport(const Graph& network);
+    void showStructureReport(const Graph& network);
     void showNodeDetails(const Node& node);
 };
 
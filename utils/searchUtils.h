@@ -0,0 +1,66 @@
+#ifndef SEARCH_UTILS_H
+#define SEARCH_UTILS_H
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <cctype>
+
+// Sorted (key, row) index for case-insensitive prefix lookups.
+// Matches for a prefix are a contiguous range, so each keystroke is a
+// binary search inside the previous range instead of a rescan of all rows.
+class PrefixIndex {
+private:
+    std::vector<std::pair<std::string, int>> entries;
+
+public:
+    static std::string normalize(const std::string& str) {
+        std::string result = str;
+        for (char& c : result) {
+            c = (char)std::tolower((unsigned char)c);
+        }
+        return result;
+    }
+
+    void build(int count, const std::function<std::string(int)>& keyOf) {
+        entries.clear();
+        entries.reserve(count);
+        for (int i = 0; i < count; i++) {
+            entries.push_back({normalize(keyOf(i)), i});
+        }
+        std::sort(entries.begin(), entries.end());
+    }
+
+    void clear() {
+        entries.clear();
+    }
+
+    bool empty() const { return entries.empty(); }
+    int size() const { return (int)entries.size(); }
+    int rowAt(int pos) const { return entries[pos].second; }
+
+    // Narrow [lo, hi) to the entries starting with prefix (already normalized)
+    std::pair<int, int> findRange(const std::string& prefix, int lo, int hi) const {
+        auto first = entries.begin() + lo;
+        auto last = entries.begin() + hi;
+
+        auto begin = std::lower_bound(first, last, prefix,
+            [](const std::pair<std::string, int>& entry, const std::string& key) {
+                return entry.first < key;
+            });
+        auto end = std::partition_point(begin, last,
+            [&prefix](const std::pair<std::string, int>& entry) {
+                return entry.first.compare(0, prefix.size(), prefix) == 0;
+            });
+
+        return {(int)(begin - entries.begin()), (int)(end - entries.begin())};
+    }
+
+    std::pair<int, int> findRange(const std::string& prefix) const {
+        return findRange(prefix, 0, size());
+    }
+};
+
+#endif
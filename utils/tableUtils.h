@@ -5,8 +5,10 @@
 #include <string>
 #include <vector>
 #include <iomanip>
+#include <functional>
 #include <conio.h>
 #include "colors.h"
+#include "searchUtils.h"
 
 struct TableRow {
     int id;
@@ -16,8 +18,17 @@ struct TableRow {
 };
 
 class InteractivePaginatedTable {
+public:
+    // Lazy data source: rows are built on demand for the visible page only
+    typedef std::function<TableRow(int)> RowProvider;
+    typedef std::function<bool(int)> IdValidator;
+    typedef std::function<std::string(int)> SearchKey;
+
 private:
     std::vector<TableRow> rows;
+    RowProvider rowProvider;
+    IdValidator idValidator;
+    int providerRowCount;
     std::string title;
     std::string col1Header;
     std::string col2Header;
@@ -27,17 +38,73 @@ private:
     int selectedIndex;
     int totalPages;
 
+    // Type-to-filter state; the index is built on the first search
+    SearchKey searchKey;
+    PrefixIndex searchIndex;
+    bool searchMode;
+    bool filtered;
+    std::string searchText;
+    int filterLo;
+    int filterHi;
+
+    int rowCount() const {
+        return rowProvider ? providerRowCount : (int)rows.size();
+    }
+
+    TableRow getRow(int index) const {
+        return rowProvider ? rowProvider(index) : rows[index];
+    }
+
+    int visibleCount() const {
+        return filtered ? filterHi - filterLo : rowCount();
+    }
+
+    int visibleRow(int pos) const {
+        return filtered ? searchIndex.rowAt(filterLo + pos) : pos;
+    }
+
+    void applyFilter(bool narrowed) {
+        if (searchText.empty()) {
+            filtered = false;
+        } else {
+            std::string prefix = PrefixIndex::normalize(searchText);
+            auto range = (filtered && narrowed)
+                ? searchIndex.findRange(prefix, filterLo, filterHi)
+                : searchIndex.findRange(prefix);
+            filterLo = range.first;
+            filterHi = range.second;
+            filtered = true;
+        }
+        currentPage = 0;
+        selectedIndex = 0;
+        updateTotalPages();
+    }
+
+    void clearFilter() {
+        searchText = "";
+        searchMode = false;
+        applyFilter(false);
+    }
+
+    bool idExists(int id) const {
+        if (idValidator) return idValidator(id);
+        for (int i = 0; i < rowCount(); i++) {
+            if (getRow(i).id == id) return true;
+        }
+        return false;
+    }
+
     void display() {
         system("cls");
         std::cout << BOLD << title << RESET << "\n";
 
-        if (rows.empty()) {
+        if (rowCount() == 0) {
             std::cout << "No data available.\n";
             return;
         }
 
         int startIdx = currentPage * pageSize;
-        int endIdx = std::min(startIdx + pageSize, (int)rows.size());
+        int endIdx = std::min(startIdx + pageSize, visibleCount());
 
         // Header
         std::cout << std::setw(6) << "ID" << " | "
@@ -51,17 +118,18 @@ private:
 
         // Rows
         for (int i = startIdx; i < endIdx; i++) {
+            TableRow row = getRow(visibleRow(i));
             if (i == selectedIndex) {
                 std::cout << CYAN << "> ";
             } else {
                 std::cout << "  ";
             }
 
-            std::cout << std::setw(4) << rows[i].id << " | "
-                      << std::setw(20) << rows[i].col1 << " | "
-                      << std::setw(15) << rows[i].col2;
-            if (!rows[i].col3.empty()) {
-                std::cout << " | " << std::setw(15) << rows[i].col3;
+            std::cout << std::setw(4) << row.id << " | "
+                      << std::setw(20) << row.col1 << " | "
+                      << std::setw(15) << row.col2;
+            if (!row.col3.empty()) {
+                std::cout << " | " << std::setw(15) << row.col3;
             }
             std::cout << RESET << "\n";
         }
@@ -69,38 +137,81 @@ private:
         // Footer
         std::cout << "\n";
         std::cout << "Page " << (currentPage + 1) << " of " << totalPages
-                  << " | Total: " << rows.size() << " items\n\n";
+                  << " | Total: " << rowCount() << " items";
+        if (filtered) {
+            std::cout << " | Matches: " << visibleCount();
+        }
+        std::cout << "\n\n";
+
+        if (searchMode) {
+            std::cout << "Search: " << searchText << "_\n";
+            std::cout << "[Type] Filter | [Enter] Done | [ESC] Clear search\n";
+            return;
+        }
+
         std::cout << "[W/S or Up/Down] Navigate | [A/D or Left/Right] Change Page\n";
-        std::cout << "[Enter] Select | [0-9] Enter ID | [ESC] Cancel\n";
+        std::cout << "[Enter] Select | [0-9] Enter ID";
+        if (searchKey) {
+            std::cout << " | [/] Search";
+        }
+        std::cout << " | [ESC] " << (filtered ? "Clear search" : "Cancel") << "\n";
     }
 
     void updateTotalPages() {
-        totalPages = (rows.size() + pageSize - 1) / pageSize;
+        totalPages = (visibleCount() + pageSize - 1) / pageSize;
         if (totalPages == 0) totalPages = 1;
     }
 
 public:
     InteractivePaginatedTable(const std::string& t, const std::string& c1,
                              const std::string& c2, const std::string& c3 = "", int ps = 5)
-        : title(t), col1Header(c1), col2Header(c2), col3Header(c3),
-          pageSize(ps), currentPage(0), selectedIndex(0) {
+        : providerRowCount(0), title(t), col1Header(c1), col2Header(c2), col3Header(c3),
+          pageSize(ps), currentPage(0), selectedIndex(0),
+          searchMode(false), filtered(false), searchText(""), filterLo(0), filterHi(0) {
         updateTotalPages();
     }
 
     void addRow(int id, const std::string& c1, const std::string& c2, const std::string& c3 = "") {
         rows.push_back({id, c1, c2, c3});
+        searchIndex.clear();
+        filtered = false;
+        updateTotalPages();
+    }
+
+    // Switch to lazy mode; validator is used for typed IDs (falls back to a scan)
+    void setDataSource(int count, RowProvider provider, IdValidator validator = nullptr) {
+        rows.clear();
+        rowProvider = provider;
+        idValidator = validator;
+        providerRowCount = count;
+        searchIndex.clear();
+        filtered = false;
+        currentPage = 0;
+        selectedIndex = 0;
         updateTotalPages();
     }
 
+    // Enable type-to-filter on the key returned for each row (e.g. name, plate)
+    void enableSearch(SearchKey key) {
+        searchKey = key;
+        searchIndex.clear();
+        filtered = false;
+    }
+
     void clearRows() {
         rows.clear();
+        searchIndex.clear();
+        filtered = false;
+        rowProvider = nullptr;
+        idValidator = nullptr;
+        providerRowCount = 0;
         currentPage = 0;
         selectedIndex = 0;
         updateTotalPages();
     }
 
     int run() {
-        if (rows.empty()) {
+        if (rowCount() == 0) {
             std::cout << "No data available.\n";
             return -1;
         }
@@ -117,6 +228,32 @@ public:
 
             int ch = _getch();
 
+            // Search mode: printable keys extend the prefix, arrows still navigate
+            if (searchMode && ch != 224 && ch != 0) {
+                if (ch == 27) { // ESC
+                    clearFilter();
+                } else if (ch == 13) { // Enter
+                    searchMode = false;
+                } else if (ch == 8) { // Backspace
+                    if (!searchText.empty()) {
+                        searchText.pop_back();
+                        applyFilter(false);
+                    }
+                } else if (ch >= 32 && ch <= 126) {
+                    searchText += (char)ch;
+                    applyFilter(true);
+                }
+                continue;
+            }
+
+            if (ch == '/' && searchKey && numberInput.empty()) {
+                if (searchIndex.empty()) {
+                    searchIndex.build(rowCount(), [this](int row) { return searchKey(row); });
+                }
+                searchMode = true;
+                continue;
+            }
+
             // Handle number input
             if (ch >= '0' && ch <= '9') {
                 numberInput += (char)ch;
@@ -133,10 +270,8 @@ public:
             if (ch == 13 && !numberInput.empty()) {
                 int enteredId = std::stoi(numberInput);
                 // Validate ID exists
-                for (const auto& row : rows) {
-                    if (row.id == enteredId) {
-                        return enteredId;
-                    }
+                if (idExists(enteredId)) {
+                    return enteredId;
                 }
                 numberInput = "";
                 continue;
@@ -153,7 +288,7 @@ public:
                         }
                     }
                 } else if (ch == 80 || ch == 'P') { // Down arrow
-                    if (selectedIndex < (int)rows.size() - 1) {
+                    if (selectedIndex < visibleCount() - 1) {
                         selectedIndex++;
                         if (selectedIndex >= (currentPage + 1) * pageSize) {
                             currentPage++;
@@ -178,7 +313,7 @@ public:
                     }
                 }
             } else if (ch == 's' || ch == 'S') {
-                if (selectedIndex < (int)rows.size() - 1) {
+                if (selectedIndex < visibleCount() - 1) {
                     selectedIndex++;
                     if (selectedIndex >= (currentPage + 1) * pageSize) {
                         currentPage++;
@@ -195,8 +330,14 @@ public:
                     selectedIndex = currentPage * pageSize;
                 }
             } else if (ch == 13) { // Enter
-                return rows[selectedIndex].id;
+                if (visibleCount() > 0) {
+                    return getRow(visibleRow(selectedIndex)).id;
+                }
             } else if (ch == 27) { // ESC
+                if (filtered) {
+                    clearFilter();
+                    continue;
+                }
                 return -1;
             }
         }